@@ -0,0 +1,327 @@
+/**
+ * @file hangman_alphabet.c
+ * @brief Alphabets as data: letter sets, case folding and keyboard layouts
+ *
+ * Each alphabet is one table row. symbols lists space-separated tokens:
+ *   "xX"    a letter x, with X its uppercase form (optional)
+ *   "éÉ=e"  a variant, shown as written but guessed as letter e
+ *   "্="    a mark, kept in words but never guessed (shown from the start)
+ *   "\\ ="  a backslash takes the next character as is, here a space mark
+ * Letters come first and are numbered in order. keyboard gives the
+ * on-screen rows, split by '|', and must hold every letter once.
+ * frequency is the fallback guess order; letters it leaves out follow in
+ * keyboard order. BuildAlphabet decodes a row into lookup tables once, so
+ * nothing downstream handles UTF-8 per character or per frame.
+ */
+
+#include "hangman_core.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const char *name;
+    const char *symbols;
+    const char *keyboard;
+    const char *frequency;
+    const char *fontFile;
+} AlphabetDefinition;
+
+/* The first entry is the default for word lists that do not name one. */
+static const AlphabetDefinition alphabetDefinitions[] = {
+    {"english",
+     "aA bB cC dD eE fF gG hH iI jJ kK lL mM nN oO pP qQ rR sS tT "
+     "uU vV wW xX yY zZ \\ = -=",
+     "abcdefghi|jklmnopqr|stuvwxyz",
+     "etaoinshrdlcumwfgypbvkjxqz",
+     NULL},
+    {"latin",
+     "aA bB cC dD eE fF gG hH iI jJ kK lL mM nN oO pP qQ rR sS tT "
+     "uU vV wW xX yY zZ æÆ ßẞ ðÐ þÞ àÀ=a áÁ=a âÂ=a ãÃ=a äÄ=a åÅ=a "
+     "çÇ=c èÈ=e éÉ=e êÊ=e ëË=e ìÌ=i íÍ=i îÎ=i ïÏ=i ñÑ=n òÒ=o óÓ=o "
+     "ôÔ=o õÕ=o öÖ=o øØ=o ùÙ=u úÚ=u ûÛ=u üÜ=u ýÝ=y ÿŸ=y \\ = -=",
+     "abcdefghij|klmnopqrst|uvwxyzæßðþ",
+     "etaoinshrdlcumwfgypbvkjxqz",
+     NULL},
+    {"spanish",
+     "aA bB cC dD eE fF gG hH iI jJ kK lL mM nN oO pP qQ rR sS tT "
+     "uU vV wW xX yY zZ ñÑ áÁ=a éÉ=e íÍ=i óÓ=o úÚ=u üÜ=u \\ = -=",
+     "abcdefghi|jklmnñopq|rstuvwxyz",
+     "eaosrnidlctumpbgvyqhfzjñxkw",
+     NULL},
+    {"german",
+     "aA bB cC dD eE fF gG hH iI jJ kK lL mM nN oO pP qQ rR sS tT "
+     "uU vV wW xX yY zZ äÄ öÖ üÜ ßẞ \\ = -=",
+     "abcdefghij|klmnopqrst|uvwxyzäöüß",
+     "enisratdhulcgmobwfkzpväüößjyxq",
+     NULL},
+    {"bengali",
+     "অ আ ই ঈ উ ঊ ঋ এ ঐ ও ঔ ক খ গ ঘ ঙ চ ছ জ ঝ ঞ ট ঠ ড ঢ ণ ত থ দ ধ "
+     "ন প ফ ব ভ ম য র ল শ ষ স হ ড় ঢ় য় ৎ ং ঃ ঁ া ি ী ু ূ ৃ ে ৈ ো ৌ "
+     "্= ়= ৗ= \u200C= \u200D=",
+     "অআইঈউঊঋএঐওঔ|"
+     "কখগঘঙচছজঝঞটঠড|"
+     "ঢণতথদধনপফবভময|"
+     "রলশষসহড়ঢ়য়ৎংঃঁ|"
+     "ািীুূৃেৈোৌ",
+     NULL,
+     "fonts/NotoSansBengali-Regular.ttf"},
+};
+
+#define ALPHABET_DEFINITION_COUNT ((int)(sizeof(alphabetDefinitions) / sizeof(alphabetDefinitions[0])))
+
+/**
+ * @brief Decodes one UTF-8 sequence from the start of text
+ * @return bytes consumed, or 0 for a malformed, overlong or truncated sequence
+ */
+int DecodeCodepoint(const char *text, size_t length, uint32_t *codepoint) {
+    const unsigned char *bytes = (const unsigned char *)text;
+    if (length == 0) return 0;
+    if (bytes[0] < 0x80) {
+        *codepoint = bytes[0];
+        return 1;
+    }
+
+    int size = (bytes[0] >= 0xF0) ? 4 : (bytes[0] >= 0xE0) ? 3 : (bytes[0] >= 0xC2) ? 2 : 0;
+    if (size == 0 || bytes[0] > 0xF4 || (size_t)size > length) return 0;
+
+    uint32_t value = bytes[0] & (0x7Fu >> size);
+    for (int i = 1; i < size; i++) {
+        if ((bytes[i] & 0xC0) != 0x80) return 0;
+        value = (value << 6) | (bytes[i] & 0x3Fu);
+    }
+    static const uint32_t minimum[5] = {0, 0, 0x80, 0x800, 0x10000};
+    if (value < minimum[size] || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) return 0;
+
+    *codepoint = value;
+    return size;
+}
+
+/**
+ * @brief Writes codepoint as UTF-8 (no terminator)
+ * @return bytes written, 1 to 4
+ */
+static int EncodeCodepoint(uint32_t codepoint, char *out) {
+    if (codepoint < 0x80) {
+        out[0] = (char)codepoint;
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        out[0] = (char)(0xC0 | (codepoint >> 6));
+        out[1] = (char)(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    if (codepoint < 0x10000) {
+        out[0] = (char)(0xE0 | (codepoint >> 12));
+        out[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (codepoint >> 18));
+    out[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (codepoint & 0x3F));
+    return 4;
+}
+
+/**
+ * @brief Makes codepoint decode to symbol
+ * @return false if the codepoint is already taken or the fold table is full
+ */
+static bool MapCodepoint(Alphabet *alphabet, uint32_t codepoint, int symbol) {
+    if (codepoint < 128) {
+        if (alphabet->asciiSymbol[codepoint] >= 0) return false;
+        alphabet->asciiSymbol[codepoint] = (int16_t)symbol;
+        return true;
+    }
+    for (int i = 0; i < alphabet->foldCount; i++) {
+        if (alphabet->foldCodepoints[i] == codepoint) return false;
+    }
+    if (alphabet->foldCount == MAX_ALPHABET_FOLDS) return false;
+
+    /* Insertion keeps the table sorted for the binary search in AlphabetSymbol */
+    int i = alphabet->foldCount++;
+    for (; i > 0 && alphabet->foldCodepoints[i - 1] > codepoint; i--) {
+        alphabet->foldCodepoints[i] = alphabet->foldCodepoints[i - 1];
+        alphabet->foldSymbols[i] = alphabet->foldSymbols[i - 1];
+    }
+    alphabet->foldCodepoints[i] = codepoint;
+    alphabet->foldSymbols[i] = (uint8_t)symbol;
+    return true;
+}
+
+/**
+ * @brief Letter whose own form is codepoint, or NO_LETTER
+ */
+static int FindLetter(const Alphabet *alphabet, uint32_t codepoint) {
+    for (int letter = 0; letter < alphabet->letterCount; letter++) {
+        if (alphabet->codepoints[letter] == codepoint) return letter;
+    }
+    return NO_LETTER;
+}
+
+/**
+ * @brief Parses the symbols field of a definition
+ */
+static bool ParseSymbols(Alphabet *alphabet, const char *text) {
+    while (*text) {
+        if (*text == ' ') {
+            text++;
+            continue;
+        }
+
+        uint32_t forms[2] = {0, 0};
+        int formCount = 0;
+        while (*text && *text != ' ' && *text != '=') {
+            if (formCount == 2) return false;
+            if (*text == '\\' && text[1]) text++;
+            int size = DecodeCodepoint(text, strlen(text), &forms[formCount++]);
+            if (size == 0) return false;
+            text += size;
+        }
+        if (formCount == 0 || alphabet->symbolCount == MAX_ALPHABET_SYMBOLS) return false;
+
+        int letter;
+        if (*text == '=') {
+            text++;
+            letter = ALPHABET_MARK;
+            if (*text && *text != ' ') {
+                uint32_t base;
+                int size = DecodeCodepoint(text, strlen(text), &base);
+                letter = size ? FindLetter(alphabet, base) : NO_LETTER;
+                if (letter == NO_LETTER) return false;
+                text += size;
+            }
+        } else {
+            /* Letters must come first so they are symbols 0..letterCount-1 */
+            if (alphabet->symbolCount != alphabet->letterCount || alphabet->letterCount == MAX_ALPHABET_LETTERS) {
+                return false;
+            }
+            letter = alphabet->letterCount++;
+        }
+
+        int symbol = alphabet->symbolCount++;
+        alphabet->codepoints[symbol] = forms[0];
+        alphabet->upperCodepoints[symbol] = forms[1];
+        alphabet->symbolLetter[symbol] = (uint8_t)letter;
+        if (!MapCodepoint(alphabet, forms[0], symbol)) return false;
+        if (formCount == 2 && !MapCodepoint(alphabet, forms[1], symbol)) return false;
+    }
+    return alphabet->letterCount > 0;
+}
+
+/**
+ * @brief Parses the keyboard rows; every letter must appear exactly once
+ */
+static bool ParseKeyboard(Alphabet *alphabet, const char *text) {
+    uint64_t placed = 0;
+    int keyCount = 0;
+    alphabet->keyboardRowCount = 1;
+
+    while (*text) {
+        if (*text == '|') {
+            if (alphabet->keyboardRowCount == MAX_KEYBOARD_ROWS) return false;
+            alphabet->keyboardRowCount++;
+            text++;
+            continue;
+        }
+        uint32_t codepoint;
+        int size = DecodeCodepoint(text, strlen(text), &codepoint);
+        int letter = size ? FindLetter(alphabet, codepoint) : NO_LETTER;
+        if (letter == NO_LETTER || ((placed >> letter) & 1u)) return false;
+
+        placed |= 1ull << letter;
+        alphabet->keyboardLetters[keyCount++] = (uint8_t)letter;
+        alphabet->keyboardRowLength[alphabet->keyboardRowCount - 1]++;
+        text += size;
+    }
+    return keyCount == alphabet->letterCount;
+}
+
+/**
+ * @brief Fills frequencyOrder from the definition, then the keyboard order
+ */
+static void BuildFrequencyOrder(Alphabet *alphabet, const char *text) {
+    uint64_t placed = 0;
+    int count = 0;
+    while (text && *text) {
+        uint32_t codepoint;
+        int size = DecodeCodepoint(text, strlen(text), &codepoint);
+        if (size == 0) break;
+        int letter = FindLetter(alphabet, codepoint);
+        if (letter != NO_LETTER && !((placed >> letter) & 1u)) {
+            placed |= 1ull << letter;
+            alphabet->frequencyOrder[count++] = (uint8_t)letter;
+        }
+        text += size;
+    }
+    for (int key = 0; key < alphabet->letterCount; key++) {
+        int letter = alphabet->keyboardLetters[key];
+        if (!((placed >> letter) & 1u)) alphabet->frequencyOrder[count++] = (uint8_t)letter;
+    }
+}
+
+/**
+ * @brief Decodes the named alphabet into its lookup tables
+ * @param name alphabet name, or NULL for the default (english)
+ * @return false if no alphabet has that name
+ */
+bool BuildAlphabet(Alphabet *alphabet, const char *name) {
+    const AlphabetDefinition *definition = NULL;
+    for (int i = 0; i < ALPHABET_DEFINITION_COUNT && !definition; i++) {
+        if (!name || strcmp(alphabetDefinitions[i].name, name) == 0) definition = &alphabetDefinitions[i];
+    }
+    if (!definition) return false;
+
+    memset(alphabet, 0, sizeof(*alphabet));
+    strncpy(alphabet->name, definition->name, ALPHABET_NAME_LENGTH - 1);
+    alphabet->fontFile = definition->fontFile;
+    for (int c = 0; c < 128; c++) alphabet->asciiSymbol[c] = -1;
+
+    if (!ParseSymbols(alphabet, definition->symbols) || !ParseKeyboard(alphabet, definition->keyboard)) return false;
+    BuildFrequencyOrder(alphabet, definition->frequency);
+    return true;
+}
+
+/**
+ * @brief Symbol a codepoint decodes to (uppercase forms fold to their lowercase symbol)
+ * @return symbol index, or -1 if the codepoint is not part of the alphabet
+ */
+int AlphabetSymbol(const Alphabet *alphabet, uint32_t codepoint) {
+    if (codepoint < 128) return alphabet->asciiSymbol[codepoint];
+
+    int low = 0, high = alphabet->foldCount - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        if (alphabet->foldCodepoints[mid] == codepoint) return alphabet->foldSymbols[mid];
+        if (alphabet->foldCodepoints[mid] < codepoint) low = mid + 1;
+        else high = mid - 1;
+    }
+    return -1;
+}
+
+/**
+ * @brief Letter a typed codepoint guesses; a variant guesses its base letter
+ * @return letter index, or NO_LETTER for marks and foreign characters
+ */
+int AlphabetLetter(const Alphabet *alphabet, uint32_t codepoint) {
+    int symbol = AlphabetSymbol(alphabet, codepoint);
+    if (symbol < 0 || alphabet->symbolLetter[symbol] == ALPHABET_MARK) return NO_LETTER;
+    return alphabet->symbolLetter[symbol];
+}
+
+/**
+ * @brief Writes symbols as NUL-terminated UTF-8, truncating at a character boundary
+ * @return bytes written, excluding the terminator
+ */
+size_t EncodeSymbols(const Alphabet *alphabet, const uint8_t *symbols, int count, char *out, size_t size) {
+    size_t used = 0;
+    for (int i = 0; i < count; i++) {
+        char encoded[4];
+        int length = EncodeCodepoint(alphabet->codepoints[symbols[i]], encoded);
+        if (used + (size_t)length >= size) break;
+        memcpy(out + used, encoded, (size_t)length);
+        used += (size_t)length;
+    }
+    if (size) out[used] = '\0';
+    return used;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file hangman_audio.c
+ * @brief Sound effects for guesses, wins and losses from a preloaded voice pool
+ *
+ * Each effect is read from sounds/<name>.wav when that file exists and is
+ * otherwise synthesized, once, at startup. Playing an effect restarts one
+ * of its preloaded voices, so the game loop does no file I/O, decoding or
+ * allocation; raylib mixes on its own audio thread in periods of about
+ * 10 ms, so a sound starts within a frame of the guess being applied.
+ * Without an audio device every call is a silent no-op.
+ */
+
+#include "hangman_types.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief One note of a synthesized effect
+ */
+typedef struct {
+    float frequency;
+    float seconds;
+} ToneNote;
+
+/**
+ * @brief How to obtain one effect; overtone adds a third harmonic for a harsher tone
+ */
+typedef struct {
+    const char *file;
+    const ToneNote *notes;
+    int noteCount;
+    float overtone;
+} SoundRecipe;
+
+static const ToneNote hitNotes[] = {{880.0f, 0.05f}, {1318.5f, 0.08f}};
+static const ToneNote missNotes[] = {{196.0f, 0.22f}};
+static const ToneNote winNotes[] = {{523.3f, 0.09f}, {659.3f, 0.09f}, {784.0f, 0.09f}, {1046.5f, 0.3f}};
+static const ToneNote loseNotes[] = {{392.0f, 0.18f}, {329.6f, 0.18f}, {261.6f, 0.45f}};
+
+static const SoundRecipe soundRecipes[SOUND_EFFECT_COUNT] = {
+    [SOUND_HIT] = {"sounds/hit.wav", hitNotes, 2, 0.0f},
+    [SOUND_MISS] = {"sounds/miss.wav", missNotes, 1, 0.6f},
+    [SOUND_WIN] = {"sounds/win.wav", winNotes, 4, 0.0f},
+    [SOUND_LOSE] = {"sounds/lose.wav", loseNotes, 3, 0.3f},
+};
+
+/**
+ * @brief Renders a recipe's notes as 16-bit mono samples and loads them as a Sound
+ *
+ * Each note fades in over 4 ms and out by its end, so notes join without clicks.
+ * @return the sound, or a zeroed Sound if the samples cannot be allocated
+ */
+static Sound SynthesizeSound(const SoundRecipe *recipe) {
+    unsigned int frameCount = 0;
+    for (int n = 0; n < recipe->noteCount; n++) {
+        frameCount += (unsigned int)(recipe->notes[n].seconds * SOUND_SAMPLE_RATE);
+    }
+    short *samples = malloc(frameCount * sizeof(short));
+    if (!samples) return (Sound){0};
+
+    unsigned int frame = 0;
+    for (int n = 0; n < recipe->noteCount; n++) {
+        const ToneNote *note = &recipe->notes[n];
+        unsigned int length = (unsigned int)(note->seconds * SOUND_SAMPLE_RATE);
+        float step = 2.0f * PI * note->frequency / SOUND_SAMPLE_RATE;
+        for (unsigned int i = 0; i < length; i++) {
+            float attack = fminf((float)i / (0.004f * SOUND_SAMPLE_RATE), 1.0f);
+            float decay = 1.0f - (float)i / (float)length;
+            float phase = step * (float)i;
+            float value = sinf(phase) + recipe->overtone * sinf(3.0f * phase) / 3.0f;
+            samples[frame++] = (short)(value * attack * decay * decay * 0.35f * 32767.0f);
+        }
+    }
+
+    Wave wave = {frameCount, SOUND_SAMPLE_RATE, 16, 1, samples};
+    Sound sound = LoadSoundFromWave(wave);
+    free(samples);
+    return sound;
+}
+
+/**
+ * @brief Loads the recipe's file if it exists and decodes, otherwise synthesizes it
+ */
+static Sound LoadEffectSound(const SoundRecipe *recipe) {
+    if (FileExists(recipe->file)) {
+        Wave wave = LoadWave(recipe->file);
+        if (IsWaveReady(wave)) {
+            Sound sound = LoadSoundFromWave(wave);
+            UnloadWave(wave);
+            return sound;
+        }
+    }
+    return SynthesizeSound(recipe);
+}
+
+/**
+ * @brief Opens the audio device if needed and prepares every effect with its voices
+ * @return false if no audio device is available (the bank then stays silent)
+ */
+bool LoadSoundBank(SoundBank *bank) {
+    memset(bank, 0, sizeof(*bank));
+    if (!IsAudioDeviceReady()) {
+        InitAudioDevice();
+        bank->ownsDevice = IsAudioDeviceReady();
+    }
+    if (!IsAudioDeviceReady()) return false;
+
+    for (int effect = 0; effect < SOUND_EFFECT_COUNT; effect++) {
+        Sound source = LoadEffectSound(&soundRecipes[effect]);
+        if (source.frameCount == 0 || !source.stream.buffer) continue;
+
+        bank->sources[effect] = source;
+        for (int voice = 0; voice < SOUND_VOICES; voice++) bank->voices[effect][voice] = LoadSoundAlias(source);
+        bank->loaded[effect] = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Releases voices before their sources, then the device if the bank opened it
+ */
+void UnloadSoundBank(SoundBank *bank) {
+    for (int effect = 0; effect < SOUND_EFFECT_COUNT; effect++) {
+        if (!bank->loaded[effect]) continue;
+        for (int voice = 0; voice < SOUND_VOICES; voice++) UnloadSoundAlias(bank->voices[effect][voice]);
+        UnloadSound(bank->sources[effect]);
+    }
+    if (bank->ownsDevice) CloseAudioDevice();
+    memset(bank, 0, sizeof(*bank));
+}
+
+/**
+ * @brief Starts the next voice of effect, restarting it if it is still playing
+ */
+void PlaySoundEffect(SoundBank *bank, SoundEffect effect) {
+    if (!bank->loaded[effect]) return;
+
+    int voice = bank->nextVoice[effect];
+    bank->nextVoice[effect] = (voice + 1) % SOUND_VOICES;
+    PlaySound(bank->voices[effect][voice]);
+}
+
+/**
+ * @brief Plays the effect for a ProcessGuess outcome; the final guess plays win or lose instead
+ */
+void PlayGuessSound(SoundBank *bank, GuessResult result, const GameState *game) {
+    if (result == GUESS_HIT) PlaySoundEffect(bank, game->isGameOver && game->isWin ? SOUND_WIN : SOUND_HIT);
+    else if (result == GUESS_MISS) PlaySoundEffect(bank, game->isGameOver ? SOUND_LOSE : SOUND_MISS);
+}
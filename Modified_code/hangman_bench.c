@@ -0,0 +1,238 @@
+/**
+ * @file hangman_bench.c
+ * @brief Headless benchmark and simulation harness for the game core
+ *
+ * Usage: hangman_bench [--words FILE | --synthetic N] [--games N]
+ *                      [--strategy random|frequency|solver|all] [--seed N]
+ *                      [--log games.hgr] [--snapshot games.hgs]
+ *
+ * Prints one JSON object per strategy on stdout, e.g. for CI comparison:
+ *   {"strategy":"solver","games":...,"games_per_sec":...,"ns_per_guess":...}
+ * With --log every simulated game is also appended to a game log. With
+ * --snapshot, --games half-played games are packed, checkpointed to the
+ * file, loaded and restored, and one more line reports the timings.
+ * POSIX only (clock_gettime, getrusage).
+ */
+
+#include "hangman_alphabet.c"
+#include "hangman_word_list.c"
+#include "hangman_dictionary.c"
+#include "hangman_random.c"
+#include "hangman_word_index.c"
+#include "hangman_game_logic.c"
+#include "hangman_game_record.c"
+#include "hangman_game_snapshot.c"
+#include "hangman_solver.c"
+#include "hangman_strategy.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+static double NowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+static long PeakMemoryKb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * @brief Generates count unique-ish "T<n>:word" lines with English letter frequencies
+ */
+static char *GenerateSyntheticWords(long count, uint64_t seed, size_t *length) {
+    static const char letters[] = "etaoinshrdlcumwfgypbvkjxqz";
+    static const int weights[] = {127, 91, 82, 75, 70, 67, 63, 61, 60, 43, 40, 28, 28,
+                                  24, 24, 22, 20, 20, 19, 15, 10, 8, 2, 2, 1, 1};
+    int cumulative[26], total = 0;
+    for (int i = 0; i < 26; i++) cumulative[i] = (total += weights[i]);
+
+    char *text = malloc((size_t)count * 24 + 1);
+    if (!text) return NULL;
+
+    Rng rng = SeedRng(seed);
+    size_t used = 0;
+    for (long n = 0; n < count; n++) {
+        used += (size_t)sprintf(text + used, "T%ld:", n % 32);
+        int wordLength = 4 + (int)RandomBelow(&rng, 9);
+        for (int i = 0; i < wordLength; i++) {
+            int pick = (int)RandomBelow(&rng, (uint32_t)total), letter = 0;
+            while (cumulative[letter] <= pick) letter++;
+            text[used++] = letters[letter];
+        }
+        text[used++] = '\n';
+    }
+    text[used] = '\0';
+    *length = used;
+    return text;
+}
+
+/**
+ * @brief Packs, saves, loads and restores games suspended mid-round, checking every one survives
+ */
+static bool BenchmarkSnapshot(const WordList *words, const char *filename, long games, uint64_t seed) {
+    PackedGame *packed = malloc((size_t)games * sizeof(PackedGame));
+    if (!packed) return false;
+
+    Rng rng = SeedRng(seed);
+    double packSeconds = 0.0;
+    for (long g = 0; g < games; g++) {
+        GameState game;
+        InitializeGame(&game, words, NextRandom(&rng));
+        for (int guess = 0; guess < 4; guess++) ProcessGuess(&game, (int)RandomBelow(&rng, (uint32_t)game.letterCount));
+        double start = NowSeconds();
+        PackGameState(&game, &packed[g]);
+        packSeconds += NowSeconds() - start;
+    }
+
+    double saveStart = NowSeconds();
+    bool ok = SaveGameSnapshot(filename, words, packed, (size_t)games);
+    double saveSeconds = NowSeconds() - saveStart;
+
+    PackedGame *loaded = NULL;
+    size_t loadedCount = 0;
+    double loadStart = NowSeconds();
+    ok = ok && LoadGameSnapshot(filename, words, &loaded, &loadedCount) && loadedCount == (size_t)games;
+    double loadSeconds = NowSeconds() - loadStart;
+
+    double restoreStart = NowSeconds();
+    long restored = 0;
+    for (size_t g = 0; ok && g < loadedCount; g++) {
+        GameState game;
+        PackedGame repacked;
+        if (!RestoreGameState(&game, words, &loaded[g])) break;
+        PackGameState(&game, &repacked);
+        if (memcmp(&repacked, &packed[g], sizeof(repacked)) != 0) break;
+        restored++;
+    }
+    double restoreSeconds = NowSeconds() - restoreStart;
+    free(loaded);
+    free(packed);
+
+    printf("{\"snapshot\":\"%s\",\"games\":%ld,\"restored\":%ld,\"bytes_per_game\":%zu,\"state_bytes\":%zu,"
+           "\"pack_ns\":%.1f,\"restore_ns\":%.1f,\"save_ms\":%.3f,\"load_ms\":%.3f}\n",
+           filename, games, restored, sizeof(PackedGame), sizeof(GameState),
+           games ? packSeconds * 1e9 / games : 0.0, restored ? restoreSeconds * 1e9 / restored : 0.0,
+           saveSeconds * 1e3, loadSeconds * 1e3);
+    return ok && restored == games;
+}
+
+int main(int argc, char **argv) {
+    const char *wordFile = "words.txt";
+    long syntheticCount = 0;
+    long games = 100000;
+    const char *strategyName = "all";
+    uint64_t seed = 12345;
+    const char *logFile = NULL;
+    const char *snapshotFile = NULL;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--words") == 0) wordFile = argv[i + 1];
+        else if (strcmp(argv[i], "--synthetic") == 0) syntheticCount = atol(argv[i + 1]);
+        else if (strcmp(argv[i], "--games") == 0) games = atol(argv[i + 1]);
+        else if (strcmp(argv[i], "--strategy") == 0) strategyName = argv[i + 1];
+        else if (strcmp(argv[i], "--seed") == 0) seed = strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "--log") == 0) logFile = argv[i + 1];
+        else if (strcmp(argv[i], "--snapshot") == 0) snapshotFile = argv[i + 1];
+        else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    WordList words;
+    bool isDictionary = false;
+    double loadStart = NowSeconds();
+    if (syntheticCount > 0) {
+        size_t length = 0;
+        char *text = GenerateSyntheticWords(syntheticCount, seed, &length);
+        loadStart = NowSeconds();
+        if (text) LoadWordListFromMemory(&words, text, length);
+        free(text);
+    } else if (LoadWordFile(wordFile, &words, &isDictionary) == 0 && isDictionary) {
+        fprintf(stderr, "%s: outdated or damaged dictionary, rebuild it with hangman_dictc\n", wordFile);
+        return 1;
+    }
+    double loadSeconds = NowSeconds() - loadStart;
+    if (words.wordCount == 0) {
+        fprintf(stderr, "no words loaded\n");
+        return 1;
+    }
+
+    double indexStart = NowSeconds();
+    WordIndex index;
+    Solver solver;
+    if (!BuildWordIndex(&index, &words) || !BuildSolver(&solver, &words, &index)) {
+        fprintf(stderr, "out of memory building indexes\n");
+        return 1;
+    }
+    double indexSeconds = NowSeconds() - indexStart;
+
+    StrategyContext context = {SeedRng(seed), &words.alphabet, &solver, {0}};
+    if (!InitializeSolverScratch(&context.scratch, &solver)) {
+        fprintf(stderr, "out of memory allocating solver scratch\n");
+        return 1;
+    }
+
+    GameLog log;
+    GameLog *gameLog = NULL;
+    if (logFile) {
+        if (!OpenGameLog(&log, logFile, &words)) {
+            fprintf(stderr, "%s: cannot open game log\n", logFile);
+            return 1;
+        }
+        gameLog = &log;
+    }
+
+    bool anyStrategy = false;
+    for (int s = 0; s < STRATEGY_COUNT; s++) {
+        const GuessStrategy *strategy = &strategies[s];
+        if (strcmp(strategyName, "all") != 0 && strcmp(strategyName, strategy->name) != 0) continue;
+        anyStrategy = true;
+
+        Rng setupRng = SeedRng(seed);
+        context.rng = SeedRng(~seed);
+        long long guesses = 0, misses = 0, wins = 0;
+        double start = NowSeconds();
+        for (long g = 0; g < games; g++) {
+            GameState game;
+            InitializeGame(&game, &words, NextRandom(&setupRng));
+            if (gameLog) BeginGameRecord(gameLog, &game, 0);
+            guesses += PlayGame(&game, strategy, &context, gameLog);
+            if (gameLog) EndGameRecord(gameLog, &game, 0);
+            misses += game.failedAttempts;
+            wins += game.isWin;
+        }
+        double seconds = NowSeconds() - start;
+
+        printf("{\"strategy\":\"%s\",\"words\":%u,\"games\":%ld,\"guesses\":%lld,"
+               "\"win_rate\":%.4f,\"avg_misses\":%.3f,\"games_per_sec\":%.1f,\"ns_per_guess\":%.1f,"
+               "\"load_ms\":%.3f,\"index_ms\":%.3f,\"peak_rss_kb\":%ld}\n",
+               strategy->name, words.wordCount, games, guesses,
+               games ? (double)wins / games : 0.0, games ? (double)misses / games : 0.0,
+               seconds > 0 ? games / seconds : 0.0, guesses ? seconds * 1e9 / guesses : 0.0,
+               loadSeconds * 1e3, indexSeconds * 1e3, PeakMemoryKb());
+    }
+
+    if (gameLog) CloseGameLog(gameLog);
+    if (snapshotFile && !BenchmarkSnapshot(&words, snapshotFile, games, seed)) {
+        fprintf(stderr, "%s: snapshot round trip failed\n", snapshotFile);
+        return 1;
+    }
+    FreeSolverScratch(&context.scratch);
+    FreeSolver(&solver);
+    FreeWordIndex(&index);
+    FreeWordList(&words);
+
+    if (!anyStrategy) {
+        fprintf(stderr, "unknown strategy %s\n", strategyName);
+        return 2;
+    }
+    return 0;
+}
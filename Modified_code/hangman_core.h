@@ -0,0 +1,466 @@
+/**
+ * @file hangman_core.h
+ * @brief Raylib-free types and constants for the Hangman game core
+ *
+ * Everything the game logic needs lives here so the logic can be built
+ * into headless hosts (servers, tools) without linking a window library.
+ */
+
+#ifndef HANGMAN_CORE_H
+#define HANGMAN_CORE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#define MAX_WORD_LENGTH     64
+#define MAX_TOPICS          65535
+#define MAX_TRIES           6
+
+#define MAX_ALPHABET_LETTERS 64
+#define MAX_ALPHABET_SYMBOLS 128
+#define MAX_ALPHABET_FOLDS   256
+#define MAX_KEYBOARD_ROWS    5
+#define ALPHABET_NAME_LENGTH 16
+#define ALPHABET_MARK        0xFF
+#define NO_LETTER            (-1)
+
+/**
+ * @brief A decoded alphabet: what may appear in words and what can be guessed
+ *
+ * Words are stored as symbol indexes. Symbols 0..letterCount-1 are the
+ * letters themselves; later symbols are variants shown as written but
+ * guessed as a base letter (e.g. an accented vowel), or marks that are
+ * never guessed and shown from the start (symbolLetter ALPHABET_MARK).
+ * Guessed letters fit one uint64_t, hence MAX_ALPHABET_LETTERS of 64.
+ * asciiSymbol and the sorted fold table map input codepoints, including
+ * uppercase forms, to symbols, so decoding a word costs one lookup per
+ * character.
+ */
+typedef struct {
+    char name[ALPHABET_NAME_LENGTH];
+    const char *fontFile;
+    int letterCount;
+    int symbolCount;
+    uint32_t codepoints[MAX_ALPHABET_SYMBOLS];
+    uint32_t upperCodepoints[MAX_ALPHABET_SYMBOLS];
+    uint8_t symbolLetter[MAX_ALPHABET_SYMBOLS];
+    int16_t asciiSymbol[128];
+    int foldCount;
+    uint32_t foldCodepoints[MAX_ALPHABET_FOLDS];
+    uint8_t foldSymbols[MAX_ALPHABET_FOLDS];
+    uint8_t frequencyOrder[MAX_ALPHABET_LETTERS];
+    int keyboardRowCount;
+    uint8_t keyboardRowLength[MAX_KEYBOARD_ROWS];
+    uint8_t keyboardLetters[MAX_ALPHABET_LETTERS];
+} Alphabet;
+
+/**
+ * @brief One dictionary word, stored as an offset into the string pool
+ *
+ * Fixed-width fields only: this is also the on-disk record of the binary
+ * dictionary format, so its layout must not change without a version bump.
+ */
+typedef struct {
+    uint32_t wordOffset;
+    uint16_t topicIndex;
+    uint8_t wordLength;
+    uint8_t distinctLetters;
+    uint64_t letterMask;
+} WordEntry;
+
+typedef struct {
+    uint32_t nameOffset;
+    uint32_t wordCount;
+} TopicEntry;
+
+/**
+ * @brief Loaded dictionary; words (wordLength symbol indexes of alphabet)
+ * and interned topic names (NUL-terminated UTF-8) share one pool
+ *
+ * dictionaryId identifies the list's contents (WordListId); a compiled
+ * dictionary stores it in its header so loading does not rehash the pool.
+ */
+typedef struct {
+    Alphabet alphabet;
+    const char *pool;
+    const WordEntry *entries;
+    const TopicEntry *topics;
+    uint32_t wordCount;
+    uint32_t topicCount;
+    uint32_t poolSize;
+    uint32_t dictionaryId;
+    void *arena;
+    TopicEntry *ownedTopics;
+    void *mapping;
+    size_t mappingSize;
+} WordList;
+
+/**
+ * @brief Word ids grouped by topic and by length for O(1) filtered draws
+ *
+ * byLength holds every word id ordered by length; lengthStart[L] is the
+ * first position with length >= L. byTopicLength is ordered by topic then
+ * length, with topicLengthStart[t * (MAX_WORD_LENGTH + 1) + L] playing the
+ * same role inside topic t.
+ */
+typedef struct {
+    uint32_t *byLength;
+    uint32_t lengthStart[MAX_WORD_LENGTH + 1];
+    uint32_t *byTopicLength;
+    uint32_t *topicLengthStart;
+    uint32_t topicCount;
+} WordIndex;
+
+#define DIFFICULTY_SCORES_FILE     "scores.csv"
+#define DIFFICULTY_RECENT_ROUNDS   10
+#define DIFFICULTY_TARGET_WIN_RATE 0.6f
+
+/**
+ * @brief Word ids ordered from easiest to hardest
+ *
+ * scores[w] is word w's position in byDifficulty scaled to 0..1, i.e. the
+ * share of the list rated easier, so a target difficulty maps straight
+ * to a position. measuredCount words had solve rates from hangman_eval.
+ */
+typedef struct {
+    float *scores;
+    uint32_t *byDifficulty;
+    uint32_t wordCount;
+    uint32_t measuredCount;
+} DifficultyIndex;
+
+/**
+ * @brief Moves a player's target difficulty with their recent results
+ *
+ * recentWins holds one bit per round, newest in bit 0, for the last
+ * recentCount (at most DIFFICULTY_RECENT_ROUNDS) rounds.
+ */
+typedef struct {
+    float target;
+    uint32_t recentWins;
+    int recentCount;
+} DifficultyTuner;
+
+/**
+ * @brief Word selection constraints; topicIndex -1 means any topic
+ */
+typedef struct {
+    int topicIndex;
+    int minLength;
+    int maxLength;
+} WordFilter;
+
+/**
+ * @brief Small fast PRNG (SplitMix64); 8 bytes of state, one per thread or game
+ */
+typedef struct {
+    uint64_t state;
+} Rng;
+
+/**
+ * @brief Complete state of one Hangman round
+ *
+ * Word positions are bits of a uint64_t (hence MAX_WORD_LENGTH of 64):
+ * secretSymbols holds the alphabet symbol at each position,
+ * letterPositions[l] marks where letter l occurs in the secret word and
+ * revealedMask marks positions already shown, so a guess is a mask lookup
+ * and drawing the word needs no text decoding.
+ * remainingLetters and livesRemaining are kept current by every reveal and
+ * guess, so the win/lose check never rescans the word. seed is the value
+ * the round was started from: the same seed and word list give the same
+ * word and the same revealed letters.
+ */
+typedef struct {
+    uint64_t seed;
+    uint32_t wordIndex;
+    char topic[MAX_WORD_LENGTH];
+    uint8_t secretSymbols[MAX_WORD_LENGTH];
+    uint64_t letterPositions[MAX_ALPHABET_LETTERS];
+    uint64_t revealedMask;
+    uint64_t guessedMask;
+    int letterCount;
+    int wordLength;
+    int uniqueLetterCount;
+    int correctGuessCount;
+    int failedAttempts;
+    int alphaPositionsTotal;
+    int remainingLetters;
+    int livesRemaining;
+    bool isGameOver;
+    bool isWin;
+} GameState;
+
+/**
+ * @brief A GameState reduced to what the word list cannot rebuild; 32 bytes
+ *
+ * The word is referenced by id and the other counters follow from the
+ * masks. failedAttempts is stored because guessing a letter that hints
+ * have already shown in full counts as a miss, which the masks cannot
+ * tell from a hit; wordLength is kept as a check against restoring with
+ * the wrong word list. Also the on-disk record of a game snapshot file.
+ */
+typedef struct {
+    uint64_t seed;
+    uint64_t guessedMask;
+    uint64_t revealedMask;
+    uint32_t wordIndex;
+    uint8_t wordLength;
+    uint8_t failedAttempts;
+    uint16_t reserved;
+} PackedGame;
+
+typedef enum {
+    GUESS_INVALID,
+    GUESS_REPEATED,
+    GUESS_GAME_OVER,
+    GUESS_HIT,
+    GUESS_MISS
+} GuessResult;
+
+/**
+ * @brief Read-only solver tables shared by every caller
+ *
+ * For each word length L the words are taken in WordIndex byLength order
+ * and containsBits holds one candidate bitset per letter ("word contains
+ * letter") starting at blockOffset[L], blockCount[L] 64-bit blocks each.
+ */
+typedef struct {
+    const WordList *words;
+    const WordIndex *index;
+    int letterCount;
+    uint64_t *containsBits;
+    size_t blockOffset[MAX_WORD_LENGTH];
+    uint32_t blockCount[MAX_WORD_LENGTH];
+    uint32_t maxBucketSize;
+} Solver;
+
+/**
+ * @brief Per-caller working memory for the solver; one per thread
+ */
+typedef struct {
+    uint64_t *candidateBits;
+    uint32_t *survivors;
+    uint64_t *letterMasks;
+    uint64_t *hashKeys;
+    uint32_t *hashCounts;
+    uint32_t *hashStamps;
+    uint32_t *hashUsed;
+    uint32_t hashUsedCount;
+    uint32_t hashCapacity;
+    uint32_t stamp;
+    uint32_t survivorCount;
+} SolverScratch;
+
+/**
+ * @brief Automatic player: returns the next letter index to guess, or NO_LETTER to give up
+ */
+typedef int (*GuessStrategyFunc)(const GameState *game, void *context);
+
+typedef struct {
+    const char *name;
+    GuessStrategyFunc guess;
+} GuessStrategy;
+
+/**
+ * @brief Per-player strategy state: its own RNG and solver scratch, so
+ * strategies can run on many threads at once
+ */
+typedef struct {
+    Rng rng;
+    const Alphabet *alphabet;
+    const Solver *solver;
+    SolverScratch scratch;
+} StrategyContext;
+
+/**
+ * @brief Outcome of every seeded game of one (word, strategy) pair
+ */
+typedef struct {
+    uint32_t plays;
+    uint32_t wins;
+    uint32_t misses;
+} WordScore;
+
+typedef struct {
+    const WordList *words;
+    const Solver *solver;
+    const GuessStrategy *strategies;
+    int strategyCount;
+    int seedsPerWord;
+    uint64_t seed;
+    int threadCount;
+} EvaluationConfig;
+
+typedef struct {
+    uint64_t games;
+    uint64_t wins;
+    uint64_t misses;
+    uint64_t guesses;
+    uint64_t steals;
+} EvaluationStats;
+
+/**
+ * @brief A word list with everything derived from it
+ *
+ * Always heap-allocated and passed by pointer: the solver and index point
+ * at the list inside the same bundle, so a bundle must never be copied.
+ */
+typedef struct {
+    WordList words;
+    WordIndex index;
+    Solver solver;
+    SolverScratch scratch;
+    DifficultyIndex difficulty;
+    bool hintsAvailable;
+    uint32_t dictionaryId;
+} WordBundle;
+
+/**
+ * @brief Watches a word file and rebuilds a WordBundle on a background thread when it changes
+ *
+ * compiledPath, if set and present, is rewritten with each reloaded list
+ * so the compiled dictionary never lags behind the watched text file.
+ */
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    WordBundle *pending;
+    WordBundle *retired;
+    int notifyFd;
+    int wakeFds[2];
+    bool stopping;
+    bool running;
+    char path[256];
+    char compiledPath[256];
+    char directory[256];
+    const char *filename;
+} WordWatcher;
+
+#define GAME_RECORD_WIN      0x01u
+#define GAME_RECORD_FINISHED 0x02u
+#define GAME_RECORD_HIT      0x40u
+#define GAME_RECORD_LETTER   0x3Fu
+
+/**
+ * @brief Fixed head of one game in a game log, followed by guessCount
+ * packed guesses (elapsedMs << 8 | GAME_RECORD_HIT | letter index),
+ * padded to 8 bytes. seed and wordIndex rebuild the round exactly.
+ */
+typedef struct {
+    uint64_t seed;
+    uint64_t startedAt;
+    uint32_t wordIndex;
+    uint32_t dictionaryId;
+    uint32_t durationMs;
+    uint16_t guessCount;
+    uint8_t misses;
+    uint8_t flags;
+} GameRecord;
+
+/**
+ * @brief Append-only writer; buffer assembles each record and keeps bytes a failed write left over
+ */
+typedef struct {
+    FILE *file;
+    unsigned char *buffer;
+    size_t used;
+    uint32_t dictionaryId;
+    GameRecord current;
+    uint32_t guesses[MAX_ALPHABET_LETTERS];
+    bool recording;
+} GameLog;
+
+typedef struct {
+    const unsigned char *data;
+    size_t size;
+    size_t offset;
+    void *arena;
+    void *mapping;
+    size_t mappingSize;
+} GameLogReader;
+
+#define STATS_NAME_LENGTH 32
+
+typedef enum {
+    STATS_PLAYER,
+    STATS_TOPIC
+} StatsKind;
+
+/**
+ * @brief Lifetime totals of one player or topic; also the on-disk record
+ *
+ * Averages are derived: misses / (wins + losses), playMs / (wins + losses).
+ */
+typedef struct {
+    uint8_t kind;
+    char name[STATS_NAME_LENGTH - 1];
+    uint32_t wins;
+    uint32_t losses;
+    uint32_t currentStreak;
+    uint32_t bestStreak;
+    uint64_t misses;
+    uint64_t playMs;
+} StatsEntry;
+
+typedef struct {
+    StatsEntry *entries;
+    uint32_t count;
+    uint32_t capacity;
+} StatsTable;
+
+/**
+ * @brief One finished round as queued for the statistics file
+ */
+typedef struct {
+    char player[STATS_NAME_LENGTH - 1];
+    char topic[STATS_NAME_LENGTH - 1];
+    uint32_t durationMs;
+    uint8_t failedAttempts;
+    bool isWin;
+} StatsGame;
+
+typedef struct {
+    StatsGame *games;
+    uint32_t count;
+    uint32_t capacity;
+} StatsGameQueue;
+
+/**
+ * @brief Background thread that adds queued rounds to the statistics file
+ */
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    StatsGameQueue pending;
+    bool stopping;
+    bool running;
+    char filename[256];
+} StatsWriter;
+
+/**
+ * @brief Session handle: slot index in the low 32 bits, slot generation in
+ * the high 32 bits, so a stale handle never reaches a recycled slot. 0 is invalid.
+ */
+typedef uint64_t SessionId;
+
+typedef struct {
+    GameState state;
+    Rng rng;
+    uint32_t generation;
+    int nextFree;
+    bool inUse;
+} SessionSlot;
+
+typedef struct {
+    SessionSlot *slots;
+    int capacity;
+    int activeCount;
+    int freeHead;
+    const WordList *words;
+} SessionPool;
+
+#endif // HANGMAN_CORE_H
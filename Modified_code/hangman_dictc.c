@@ -0,0 +1,46 @@
+/**
+ * @file hangman_dictc.c
+ * @brief Offline compiler: words.txt -> binary dictionary (words.hgd)
+ *
+ * Usage: hangman_dictc [input.txt] [output.hgd]
+ *        hangman_dictc --verify dictionary.hgd
+ */
+
+#include "hangman_alphabet.c"
+#include "hangman_word_list.c"
+#include "hangman_dictionary.c"
+
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+    if (argc == 3 && strcmp(argv[1], "--verify") == 0) {
+        WordList list;
+        int count = LoadDictionary(argv[2], &list, true);
+        if (count == 0) {
+            fprintf(stderr, "%s: not a valid dictionary\n", argv[2]);
+            return 1;
+        }
+        printf("%s: %d words, %u topics, %s alphabet, checksum and entries OK\n", argv[2], count, list.topicCount,
+               list.alphabet.name);
+        FreeWordList(&list);
+        return 0;
+    }
+
+    const char *input = (argc > 1) ? argv[1] : "words.txt";
+    const char *output = (argc > 2) ? argv[2] : "words.hgd";
+
+    WordList list;
+    int count = LoadWordList(input, &list);
+    if (count == 0) {
+        fprintf(stderr, "%s: no words loaded\n", input);
+        return 1;
+    }
+
+    bool ok = WriteDictionary(&list, output);
+    if (ok) printf("%s: %d words, %u topics -> %s\n", input, count, list.topicCount, output);
+    else fprintf(stderr, "%s: write failed\n", output);
+
+    FreeWordList(&list);
+    return ok ? 0 : 1;
+}
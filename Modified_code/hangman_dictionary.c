@@ -0,0 +1,287 @@
+/**
+ * @file hangman_dictionary.c
+ * @brief Precompiled binary dictionary: writer and zero-parse loader
+ *
+ * Layout (little-endian, every section 8-byte aligned):
+ *   DictionaryHeader | TopicEntry[topicCount] | WordEntry[wordCount] | string pool
+ * Words are stored as the text loader leaves them: symbols of the
+ * alphabet named in the header, no duplicates (version 5). The header
+ * also carries the list's dictionaryId, so game logs need not hash it.
+ *
+ * The loader maps the file read-only and points a WordList straight at
+ * the sections after checking only the header and section bounds, so
+ * startup cost does not depend on the dictionary size and concurrent game
+ * processes share the pages through the page cache. The checksum and the
+ * per-entry checks run on request (hangman_dictc --verify).
+ * Requires hangman_alphabet.c and hangman_word_list.c in the same build.
+ */
+
+#include "hangman_core.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <process.h>
+#define fsync _commit
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#define DICTIONARY_MAGIC      "HGMDICT"
+#define DICTIONARY_VERSION    5
+#define DICTIONARY_BYTE_ORDER 0x01020304u
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t headerSize;
+    uint32_t wordCount;
+    uint32_t topicCount;
+    uint32_t poolSize;
+    uint32_t dictionaryId;
+    uint32_t reserved;
+    char alphabet[ALPHABET_NAME_LENGTH];
+    uint64_t topicsOffset;
+    uint64_t entriesOffset;
+    uint64_t poolOffset;
+    uint64_t fileSize;
+    uint64_t checksum;
+} DictionaryHeader;
+
+/**
+ * @brief FNV-1a 64 over a byte range; used as the dictionary checksum
+ */
+static uint64_t DictionaryChecksum(const unsigned char *data, size_t length, uint64_t hash) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static uint64_t AlignSection(uint64_t offset) {
+    return (offset + 7u) & ~(uint64_t)7u;
+}
+
+/**
+ * @brief Writes one section followed by zero padding up to the next 8-byte boundary
+ */
+static bool WriteSection(FILE *file, const void *data, size_t length, uint64_t *checksum) {
+    static const unsigned char padding[8] = {0};
+    size_t padLength = (size_t)(AlignSection(length) - length);
+    if (fwrite(data, 1, length, file) != length) return false;
+    if (fwrite(padding, 1, padLength, file) != padLength) return false;
+    *checksum = DictionaryChecksum(data, length, *checksum);
+    *checksum = DictionaryChecksum(padding, padLength, *checksum);
+    return true;
+}
+
+/**
+ * @brief Compiles a loaded word list into a binary dictionary file
+ *
+ * The file is written beside the target and renamed over it, so a game
+ * that has the old dictionary mapped keeps valid pages and a watcher
+ * only ever sees the finished file move in.
+ * @return false on any I/O failure (the previous file is left untouched)
+ */
+bool WriteDictionary(const WordList *list, const char *filename) {
+    DictionaryHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DICTIONARY_MAGIC, sizeof(header.magic));
+    header.version = DICTIONARY_VERSION;
+    header.byteOrder = DICTIONARY_BYTE_ORDER;
+    header.headerSize = (uint32_t)sizeof(DictionaryHeader);
+    header.wordCount = list->wordCount;
+    header.topicCount = list->topicCount;
+    header.poolSize = list->poolSize;
+    header.dictionaryId = list->dictionaryId;
+    memcpy(header.alphabet, list->alphabet.name, sizeof(header.alphabet));
+    header.topicsOffset = AlignSection(sizeof(DictionaryHeader));
+    header.entriesOffset = header.topicsOffset + AlignSection((uint64_t)list->topicCount * sizeof(TopicEntry));
+    header.poolOffset = header.entriesOffset + AlignSection((uint64_t)list->wordCount * sizeof(WordEntry));
+    header.fileSize = header.poolOffset + AlignSection(list->poolSize);
+
+    char tempName[272];
+    snprintf(tempName, sizeof(tempName), "%s.%ld.tmp", filename, (long)getpid());
+    FILE *file = fopen(tempName, "wb");
+    if (!file) return false;
+
+    /* Header goes first with a zero checksum and is rewritten once the payload hash is known. */
+    uint64_t checksum = 14695981039346656037ull;
+    uint64_t unused = 0;
+    bool ok = WriteSection(file, &header, sizeof(header), &unused) &&
+              WriteSection(file, list->topics, (size_t)list->topicCount * sizeof(TopicEntry), &checksum) &&
+              WriteSection(file, list->entries, (size_t)list->wordCount * sizeof(WordEntry), &checksum) &&
+              WriteSection(file, list->pool, list->poolSize, &checksum);
+
+    header.checksum = checksum;
+    ok = ok && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1 &&
+         fflush(file) == 0 && fsync(fileno(file)) == 0;
+    ok = (fclose(file) == 0) && ok;
+
+#ifdef _WIN32
+    /* rename does not replace an existing file on Windows */
+    if (ok) remove(filename);
+#endif
+    ok = ok && rename(tempName, filename) == 0;
+    if (!ok) remove(tempName);
+    return ok;
+}
+
+/**
+ * @brief Checks that every topic and word of a dictionary image stays inside its pool and alphabet
+ *
+ * Words get the length limit of the text loader, every symbol must belong
+ * to the alphabet and the stored letter set must match the symbols, since
+ * the game, index and solver index fixed-size tables with all of them.
+ * O(dictionary size), so only run when verifying.
+ */
+static bool ValidateDictionaryEntries(const WordList *list) {
+    for (uint32_t t = 0; t < list->topicCount; t++) {
+        uint32_t offset = list->topics[t].nameOffset;
+        if (offset >= list->poolSize || !memchr(list->pool + offset, '\0', list->poolSize - offset)) return false;
+    }
+
+    const Alphabet *alphabet = &list->alphabet;
+    for (uint32_t w = 0; w < list->wordCount; w++) {
+        const WordEntry *entry = &list->entries[w];
+        if (entry->wordLength == 0 || entry->wordLength >= MAX_WORD_LENGTH) return false;
+        if ((uint64_t)entry->wordOffset + entry->wordLength > list->poolSize || entry->topicIndex >= list->topicCount) {
+            return false;
+        }
+
+        const uint8_t *symbols = (const uint8_t *)list->pool + entry->wordOffset;
+        uint64_t mask = 0;
+        for (int i = 0; i < entry->wordLength; i++) {
+            if (symbols[i] >= alphabet->symbolCount) return false;
+            int letter = alphabet->symbolLetter[symbols[i]];
+            if (letter != ALPHABET_MARK) mask |= 1ull << letter;
+        }
+        if (entry->letterMask != mask || entry->distinctLetters != __builtin_popcountll(mask)) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Validates a mapped dictionary image and points list at its sections
+ *
+ * The header and section bounds are always checked, in O(1). With verify
+ * the checksum, every entry and the stored dictionary id are checked too.
+ */
+static bool AttachDictionary(WordList *list, const unsigned char *image, size_t size, bool verify) {
+    if (size < sizeof(DictionaryHeader)) return false;
+
+    const DictionaryHeader *header = (const DictionaryHeader *)image;
+    if (memcmp(header->magic, DICTIONARY_MAGIC, sizeof(header->magic)) != 0) return false;
+    if (header->version != DICTIONARY_VERSION || header->byteOrder != DICTIONARY_BYTE_ORDER) return false;
+    if (header->headerSize != sizeof(DictionaryHeader) || header->fileSize != size) return false;
+    if (header->wordCount == 0 || header->topicCount > MAX_TOPICS) return false;
+    if (!memchr(header->alphabet, '\0', sizeof(header->alphabet)) ||
+        !BuildAlphabet(&list->alphabet, header->alphabet)) return false;
+
+    uint64_t topicsEnd = header->topicsOffset + (uint64_t)header->topicCount * sizeof(TopicEntry);
+    uint64_t entriesEnd = header->entriesOffset + (uint64_t)header->wordCount * sizeof(WordEntry);
+    uint64_t poolEnd = header->poolOffset + header->poolSize;
+    if (header->topicsOffset < sizeof(DictionaryHeader) || topicsEnd > header->entriesOffset ||
+        entriesEnd > header->poolOffset || poolEnd > size) return false;
+    if ((header->topicsOffset | header->entriesOffset | header->poolOffset) & 7u) return false;
+
+    if (verify) {
+        uint64_t checksum = DictionaryChecksum(image + header->topicsOffset, size - header->topicsOffset,
+                                               14695981039346656037ull);
+        if (checksum != header->checksum) return false;
+    }
+
+    list->topics = (const TopicEntry *)(image + header->topicsOffset);
+    list->entries = (const WordEntry *)(image + header->entriesOffset);
+    list->pool = (const char *)(image + header->poolOffset);
+    list->wordCount = header->wordCount;
+    list->topicCount = header->topicCount;
+    list->poolSize = header->poolSize;
+    list->dictionaryId = header->dictionaryId;
+    return !verify || (ValidateDictionaryEntries(list) && WordListId(list) == header->dictionaryId);
+}
+
+/**
+ * @brief Maps a binary dictionary for direct use as a WordList
+ *
+ * Without verify only the header and section bounds are checked, so
+ * loading is O(1); with it the payload is hashed and every entry checked
+ * (hangman_dictc --verify, once per compiled file).
+ * @return number of words, 0 if the file is missing, foreign or corrupt
+ */
+int LoadDictionary(const char *filename, WordList *list, bool verify) {
+    memset(list, 0, sizeof(*list));
+
+#ifdef WORD_LIST_USE_STDIO
+    FILE *file = fopen(filename, "rb");
+    if (!file) return 0;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    void *image = (size > 0) ? malloc((size_t)size) : NULL;
+    bool ok = image && fread(image, 1, (size_t)size, file) == (size_t)size &&
+              AttachDictionary(list, image, (size_t)size, verify);
+    fclose(file);
+    if (!ok) {
+        free(image);
+        memset(list, 0, sizeof(*list));
+        return 0;
+    }
+    list->arena = image;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return 0;
+
+    struct stat info;
+    void *mapping = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) return 0;
+
+    if (!AttachDictionary(list, mapping, (size_t)info.st_size, verify)) {
+        munmap(mapping, (size_t)info.st_size);
+        memset(list, 0, sizeof(*list));
+        return 0;
+    }
+    list->mapping = mapping;
+    list->mappingSize = (size_t)info.st_size;
+#endif
+
+    return (int)list->wordCount;
+}
+
+/**
+ * @brief Whether filename starts with the binary dictionary magic (whatever its version)
+ */
+bool IsDictionaryFile(const char *filename) {
+    FILE *file = fopen(filename, "rb");
+    if (!file) return false;
+
+    char magic[8];
+    bool found = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                 memcmp(magic, DICTIONARY_MAGIC, sizeof(magic)) == 0;
+    fclose(file);
+    return found;
+}
+
+/**
+ * @brief Loads a word file, picking the loader by its first bytes
+ *
+ * A file with the dictionary magic is attached as a binary dictionary and
+ * is never parsed as text, so an outdated or damaged one loads nothing
+ * instead of garbage; anything else is read as "topic:word" lines.
+ * @param isDictionary if not NULL, set to whether the file was taken as a dictionary
+ * @return number of words, 0 if the file is missing, corrupt or holds none
+ */
+int LoadWordFile(const char *filename, WordList *list, bool *isDictionary) {
+    bool dictionary = IsDictionaryFile(filename);
+    if (isDictionary) *isDictionary = dictionary;
+    return dictionary ? LoadDictionary(filename, list, false) : LoadWordList(filename, list);
+}
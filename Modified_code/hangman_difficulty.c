@@ -0,0 +1,293 @@
+/**
+ * @file hangman_difficulty.c
+ * @brief Word difficulty ratings, difficulty-targeted draws and adaptive targets
+ *
+ * Every word gets an estimate when the list is loaded: mostly the mean
+ * rarity of its letters (how few words of the list contain them), raised
+ * for words with few distinct letters, which leave little to hit, and
+ * lowered slightly for repeated letters, which one guess reveals at once.
+ * Where hangman_eval measured the word (DIFFICULTY_SCORES_FILE), its loss
+ * rate is blended in, weighted by how often it was played. Both are
+ * compared as ranks, so a word's difficulty is the share of the list
+ * rated easier and any target in 0..1 maps to a position in
+ * byDifficulty: drawing near a target is O(1).
+ * Requires hangman_word_list.c, hangman_random.c and hangman_game_logic.c
+ * in the same build.
+ */
+
+#include "hangman_core.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DIFFICULTY_PRIOR_PLAYS 16.0f
+#define DIFFICULTY_SPREAD      0.05f
+#define DIFFICULTY_STEP        0.25f
+
+typedef struct {
+    float value;
+    uint32_t word;
+} RankedWord;
+
+static int CompareRankedWords(const void *a, const void *b) {
+    const RankedWord *x = a, *y = b;
+    if (x->value != y->value) return (x->value > y->value) - (x->value < y->value);
+    return (x->word > y->word) - (x->word < y->word);
+}
+
+/**
+ * @brief Sorts items and stores each word's rank, scaled to 0..1, in ranks[word]
+ *
+ * Equal values share the mean rank of their run.
+ */
+static void RankWords(RankedWord *items, uint32_t count, float *ranks) {
+    qsort(items, count, sizeof(RankedWord), CompareRankedWords);
+    float scale = count > 1 ? 1.0f / (float)(count - 1) : 0.0f;
+    for (uint32_t first = 0, end; first < count; first = end) {
+        for (end = first + 1; end < count && items[end].value == items[first].value; end++) {}
+        float rank = (float)(first + end - 1) * 0.5f * scale;
+        for (uint32_t i = first; i < end; i++) ranks[items[i].word] = rank;
+    }
+}
+
+/**
+ * @brief Rates a word from its letters alone; larger is harder, on no fixed scale
+ * @param letterRarity per letter, -log2 of the share of words containing it, over log2 of the word count
+ */
+static float EstimateDifficulty(const WordEntry *entry, const float *letterRarity) {
+    if (entry->distinctLetters == 0) return 0.0f;
+
+    float rarity = 0.0f;
+    for (uint64_t letters = entry->letterMask; letters; letters &= letters - 1) {
+        rarity += letterRarity[__builtin_ctzll(letters)];
+    }
+    rarity /= (float)entry->distinctLetters;
+    int repeats = entry->wordLength > entry->distinctLetters ? entry->wordLength - entry->distinctLetters : 0;
+
+    // Weights fitted against hangman_eval loss rates of the frequency and solver players
+    return 0.6f * rarity + 0.1f / (float)entry->distinctLetters - 0.02f * (float)repeats / (float)entry->wordLength;
+}
+
+/**
+ * @brief Splits the next RFC 4180 field off a CSV line, unquoting it in place
+ * @param cursor start of the field; set to the next field, or NULL after the last one
+ * @return the field, or NULL if there is none or its quotes are malformed
+ */
+static char *NextCsvField(char **cursor) {
+    char *field = *cursor;
+    if (!field) return NULL;
+
+    char *end;
+    if (*field == '"') {
+        char *out = field;
+        char *in = field + 1;
+        for (;; in++) {
+            if (*in == '\0') return NULL;
+            if (*in == '"') {
+                if (in[1] != '"') break;
+                in++;
+            }
+            *out++ = *in;
+        }
+        *out = '\0';
+        end = in + 1;
+    } else {
+        end = field + strcspn(field, ",\r\n");
+    }
+
+    if (*end == ',') {
+        *cursor = end + 1;
+    } else if (*end == '\0' || strcmp(end, "\n") == 0 || strcmp(end, "\r\n") == 0) {
+        *cursor = NULL;
+    } else {
+        return NULL;
+    }
+    *end = '\0';
+    return field;
+}
+
+/**
+ * @brief Reads hangman_eval output for words, summing plays and losses per word
+ *
+ * The file lists words in id order, so each row is matched by position
+ * and checked against the word's text and topic. Rows of the random strategy are
+ * skipped: it loses nearly every word and would only add noise.
+ * @return false if the file is missing, malformed or written for another list
+ */
+static bool LoadMeasuredScores(const WordList *words, const char *filename, uint32_t *plays, uint32_t *losses) {
+    FILE *file = fopen(filename, "r");
+    if (!file) return false;
+
+    char line[1024];
+    char text[4 * MAX_WORD_LENGTH + 1];
+    bool ok = fgets(line, sizeof(line), file) && strncmp(line, "word,", 5) == 0;
+    int64_t current = -1;
+    while (ok && fgets(line, sizeof(line), file)) {
+        // word,topic,strategy,plays,wins,solve_rate,avg_misses
+        char *fields[7];
+        char *cursor = line;
+        int found = 0;
+        while (found < 7 && (fields[found] = NextCsvField(&cursor))) found++;
+        if (found < 7 || cursor) {
+            ok = false;
+            break;
+        }
+
+        if (current < 0 || strcmp(fields[0], text) != 0 || strcmp(fields[1], WordListTopic(words, (uint32_t)current)) != 0) {
+            current++;
+            ok = (uint32_t)current < words->wordCount;
+            if (ok) WordListWordText(words, (uint32_t)current, text, sizeof(text));
+            ok = ok && strcmp(fields[0], text) == 0 && strcmp(fields[1], WordListTopic(words, (uint32_t)current)) == 0;
+        }
+
+        if (!ok || strcmp(fields[2], "random") == 0) continue;
+        unsigned long rowPlays = strtoul(fields[3], NULL, 10);
+        unsigned long rowWins = strtoul(fields[4], NULL, 10);
+        if (rowWins > rowPlays) rowWins = rowPlays;
+        plays[current] += (uint32_t)rowPlays;
+        losses[current] += (uint32_t)(rowPlays - rowWins);
+    }
+    fclose(file);
+    return ok && current + 1 == (int64_t)words->wordCount;
+}
+
+void FreeDifficultyIndex(DifficultyIndex *index) {
+    free(index->scores);
+    free(index->byDifficulty);
+    memset(index, 0, sizeof(*index));
+}
+
+/**
+ * @brief Rates every word of words and orders them from easiest to hardest
+ * @param scoresFile hangman_eval output to blend in, or NULL; ignored if it does not match words
+ * @return false on allocation failure or an empty list (index is left empty)
+ */
+bool BuildDifficultyIndex(DifficultyIndex *index, const WordList *words, const char *scoresFile) {
+    memset(index, 0, sizeof(*index));
+    uint32_t count = words->wordCount;
+    if (count == 0) return false;
+
+    index->scores = malloc((size_t)count * sizeof(float));
+    index->byDifficulty = malloc((size_t)count * sizeof(uint32_t));
+    RankedWord *ranked = malloc((size_t)count * sizeof(RankedWord));
+    float *measuredRanks = malloc((size_t)count * sizeof(float));
+    uint32_t *plays = calloc(count, sizeof(uint32_t));
+    uint32_t *losses = calloc(count, sizeof(uint32_t));
+    bool ok = index->scores && index->byDifficulty && ranked && measuredRanks && plays && losses;
+
+    if (ok) {
+        uint32_t letterWords[MAX_ALPHABET_LETTERS] = {0};
+        for (uint32_t w = 0; w < count; w++) {
+            for (uint64_t letters = words->entries[w].letterMask; letters; letters &= letters - 1) {
+                letterWords[__builtin_ctzll(letters)]++;
+            }
+        }
+        float letterRarity[MAX_ALPHABET_LETTERS] = {0};
+        float normalize = count > 1 ? 1.0f / log2f((float)count) : 0.0f;
+        for (int l = 0; l < MAX_ALPHABET_LETTERS; l++) {
+            if (letterWords[l]) letterRarity[l] = -log2f((float)letterWords[l] / (float)count) * normalize;
+        }
+
+        for (uint32_t w = 0; w < count; w++) {
+            ranked[w] = (RankedWord){EstimateDifficulty(&words->entries[w], letterRarity), w};
+        }
+        RankWords(ranked, count, index->scores);
+
+        uint32_t measured = 0;
+        if (scoresFile && LoadMeasuredScores(words, scoresFile, plays, losses)) {
+            for (uint32_t w = 0; w < count; w++) {
+                if (plays[w]) ranked[measured++] = (RankedWord){(float)losses[w] / (float)plays[w], w};
+            }
+            RankWords(ranked, measured, measuredRanks);
+        }
+        index->measuredCount = measured;
+
+        for (uint32_t w = 0; w < count; w++) {
+            float score = index->scores[w];
+            if (measured && plays[w]) {
+                score = (score * DIFFICULTY_PRIOR_PLAYS + measuredRanks[w] * (float)plays[w]) /
+                        (DIFFICULTY_PRIOR_PLAYS + (float)plays[w]);
+            }
+            ranked[w] = (RankedWord){score, w};
+        }
+        qsort(ranked, count, sizeof(RankedWord), CompareRankedWords);
+        float scale = count > 1 ? 1.0f / (float)(count - 1) : 0.0f;
+        for (uint32_t position = 0; position < count; position++) {
+            index->byDifficulty[position] = ranked[position].word;
+            index->scores[ranked[position].word] = (float)position * scale;
+        }
+        index->wordCount = count;
+    }
+
+    free(ranked);
+    free(measuredRanks);
+    free(plays);
+    free(losses);
+    if (!ok) FreeDifficultyIndex(index);
+    return ok;
+}
+
+/**
+ * @brief Draws a word rated within DIFFICULTY_SPREAD of target, each equally likely
+ * @param target 0 (easiest word) to 1 (hardest); clamped
+ * @return false if the index is empty (nothing is drawn from rng)
+ */
+bool SelectWordByDifficulty(const DifficultyIndex *index, float target, Rng *rng, uint32_t *wordIndex) {
+    if (index->wordCount == 0) return false;
+
+    float last = (float)(index->wordCount - 1);
+    float center = (target < 0.0f ? 0.0f : target > 1.0f ? 1.0f : target) * last;
+    float half = DIFFICULTY_SPREAD * last;
+    uint32_t first = center > half ? (uint32_t)(center - half) : 0;
+    uint32_t end = center + half < last ? (uint32_t)(center + half) + 1 : index->wordCount;
+
+    *wordIndex = index->byDifficulty[first + RandomBelow(rng, end - first)];
+    return true;
+}
+
+/**
+ * @brief Initializes game state with a word near target difficulty, chosen by seed
+ *
+ * Like the other seeded initializers the word is drawn from the start of
+ * the seed's stream, so the round replays from (seed, word). Falls back to InitializeGame if
+ * difficulty was not built for words.
+ */
+void InitializeGameAtDifficulty(GameState *game, const WordList *words, const DifficultyIndex *difficulty,
+                                float target, uint64_t seed) {
+    Rng rng = SeedRng(seed);
+    uint32_t idx;
+    if (difficulty->wordCount != words->wordCount ||
+        !SelectWordByDifficulty(difficulty, target, &rng, &idx)) {
+        InitializeGame(game, words, seed);
+        return;
+    }
+    StartSeededGame(game, words, idx, seed);
+}
+
+/**
+ * @brief Starts a tuner from a player's lifetime record, or at the middle without one
+ */
+void InitializeDifficultyTuner(DifficultyTuner *tuner, const StatsEntry *player) {
+    memset(tuner, 0, sizeof(*tuner));
+    tuner->target = 0.5f;
+    if (player && player->wins + player->losses > 0) {
+        float winRate = (float)player->wins / (float)(player->wins + player->losses);
+        tuner->target = fminf(fmaxf(0.5f + winRate - DIFFICULTY_TARGET_WIN_RATE, 0.0f), 1.0f);
+    }
+}
+
+/**
+ * @brief Adds a finished round and moves the target toward DIFFICULTY_TARGET_WIN_RATE
+ *
+ * Winning more often than that over the recent rounds raises the target,
+ * losing more often lowers it, in proportion to the gap.
+ */
+void RecordDifficultyResult(DifficultyTuner *tuner, bool won) {
+    tuner->recentWins = ((tuner->recentWins << 1) | (won ? 1u : 0u)) & ((1u << DIFFICULTY_RECENT_ROUNDS) - 1);
+    if (tuner->recentCount < DIFFICULTY_RECENT_ROUNDS) tuner->recentCount++;
+
+    float winRate = (float)__builtin_popcount(tuner->recentWins) / (float)tuner->recentCount;
+    tuner->target += DIFFICULTY_STEP * (winRate - DIFFICULTY_TARGET_WIN_RATE);
+    tuner->target = fminf(fmaxf(tuner->target, 0.0f), 1.0f);
+}
@@ -0,0 +1,167 @@
+/**
+ * @file hangman_eval.c
+ * @brief Plays every dictionary word against every strategy on all cores
+ *
+ * Usage: hangman_eval [--words FILE] [--strategy random|frequency|solver|all]
+ *                     [--seeds N] [--seed N] [--threads N] [--out scores.csv]
+ *
+ * Writes one CSV row per (word, strategy) with its solve rate and average
+ * misses, and prints one JSON summary line per strategy on stdout. The
+ * game blends a scores.csv in its working directory into its word
+ * difficulty ratings.
+ * POSIX only (pthreads, sysconf).
+ */
+
+#include "hangman_alphabet.c"
+#include "hangman_word_list.c"
+#include "hangman_dictionary.c"
+#include "hangman_random.c"
+#include "hangman_word_index.c"
+#include "hangman_game_logic.c"
+#include "hangman_game_record.c"
+#include "hangman_solver.c"
+#include "hangman_strategy.c"
+#include "hangman_evaluator.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static double NowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Writes one CSV field, quoted per RFC 4180 when it holds a comma, quote or line break
+ */
+static void WriteCsvField(FILE *file, const char *field) {
+    if (!strpbrk(field, ",\"\r\n")) {
+        fputs(field, file);
+        return;
+    }
+    fputc('"', file);
+    for (const char *c = field; *c; c++) {
+        if (*c == '"') fputc('"', file);
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+/**
+ * @brief Writes the per-word scores as CSV
+ */
+static bool WriteScores(const char *filename, const EvaluationConfig *config, const WordScore *scores) {
+    FILE *file = fopen(filename, "w");
+    if (!file) return false;
+
+    fprintf(file, "word,topic,strategy,plays,wins,solve_rate,avg_misses\n");
+    const WordList *words = config->words;
+    char text[4 * MAX_WORD_LENGTH + 1];
+    for (uint32_t w = 0; w < words->wordCount; w++) {
+        WordListWordText(words, w, text, sizeof(text));
+        for (int s = 0; s < config->strategyCount; s++) {
+            const WordScore *score = &scores[(size_t)w * (size_t)config->strategyCount + (size_t)s];
+            WriteCsvField(file, text);
+            fputc(',', file);
+            WriteCsvField(file, WordListTopic(words, w));
+            fputc(',', file);
+            WriteCsvField(file, config->strategies[s].name);
+            fprintf(file, ",%u,%u,%.4f,%.3f\n", score->plays, score->wins,
+                    score->plays ? (double)score->wins / score->plays : 0.0,
+                    score->plays ? (double)score->misses / score->plays : 0.0);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+int main(int argc, char **argv) {
+    const char *wordFile = "words.txt";
+    const char *outFile = "scores.csv";
+    const char *strategyName = "all";
+    int seedsPerWord = 16;
+    unsigned long long seed = 12345;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--words") == 0) wordFile = argv[i + 1];
+        else if (strcmp(argv[i], "--out") == 0) outFile = argv[i + 1];
+        else if (strcmp(argv[i], "--strategy") == 0) strategyName = argv[i + 1];
+        else if (strcmp(argv[i], "--seeds") == 0) seedsPerWord = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--seed") == 0) seed = strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "--threads") == 0) threads = atol(argv[i + 1]);
+        else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    GuessStrategy selected[STRATEGY_COUNT];
+    int strategyCount = 0;
+    for (int s = 0; s < STRATEGY_COUNT; s++) {
+        if (strcmp(strategyName, "all") == 0 || strcmp(strategyName, strategies[s].name) == 0) {
+            selected[strategyCount++] = strategies[s];
+        }
+    }
+    if (strategyCount == 0) {
+        fprintf(stderr, "unknown strategy %s\n", strategyName);
+        return 2;
+    }
+
+    WordList words;
+    bool isDictionary;
+    if (LoadWordFile(wordFile, &words, &isDictionary) == 0 && isDictionary) {
+        fprintf(stderr, "%s: outdated or damaged dictionary, rebuild it with hangman_dictc\n", wordFile);
+        return 1;
+    }
+    if (words.wordCount == 0) {
+        fprintf(stderr, "no words loaded\n");
+        return 1;
+    }
+
+    WordIndex index;
+    Solver solver;
+    if (!BuildWordIndex(&index, &words) || !BuildSolver(&solver, &words, &index)) {
+        fprintf(stderr, "out of memory building indexes\n");
+        return 1;
+    }
+
+    EvaluationConfig config = {&words, &solver, selected, strategyCount, seedsPerWord,
+                               (uint64_t)seed, threads > 0 ? (int)threads : 1};
+    WordScore *scores = malloc((size_t)words.wordCount * (size_t)strategyCount * sizeof(WordScore));
+    EvaluationStats stats;
+
+    double start = NowSeconds();
+    bool ok = scores && RunEvaluation(&config, scores, &stats);
+    double seconds = NowSeconds() - start;
+
+    if (!ok) fprintf(stderr, "evaluation failed\n");
+    else if (!WriteScores(outFile, &config, scores)) fprintf(stderr, "%s: write failed\n", outFile);
+    else {
+        for (int s = 0; s < strategyCount; s++) {
+            unsigned long long plays = 0, wins = 0, misses = 0;
+            for (uint32_t w = 0; w < words.wordCount; w++) {
+                const WordScore *score = &scores[(size_t)w * (size_t)strategyCount + (size_t)s];
+                plays += score->plays;
+                wins += score->wins;
+                misses += score->misses;
+            }
+            printf("{\"strategy\":\"%s\",\"words\":%u,\"games\":%llu,\"win_rate\":%.4f,\"avg_misses\":%.3f}\n",
+                   selected[s].name, words.wordCount, plays,
+                   plays ? (double)wins / plays : 0.0, plays ? (double)misses / plays : 0.0);
+        }
+        printf("{\"threads\":%d,\"games\":%llu,\"guesses\":%llu,\"steals\":%llu,"
+               "\"seconds\":%.3f,\"games_per_sec\":%.1f}\n",
+               config.threadCount, (unsigned long long)stats.games, (unsigned long long)stats.guesses,
+               (unsigned long long)stats.steals, seconds, seconds > 0 ? stats.games / seconds : 0.0);
+    }
+
+    free(scores);
+    FreeSolver(&solver);
+    FreeWordIndex(&index);
+    FreeWordList(&words);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file hangman_evaluator.c
+ * @brief Multi-core evaluation: every word against every strategy
+ *
+ * A job is one (word, strategy) pair played seedsPerWord times. Jobs are
+ * split into one contiguous range per thread; a thread pops small chunks
+ * from the front of its own range and, once it runs dry, steals the back
+ * half of another thread's range. Each range is a single atomic word, so
+ * neither side takes a lock. Game seeds come from DeriveSeed(seed, word,
+ * strategy, round), which makes the scores independent of thread count
+ * and scheduling. Requires hangman_random.c, hangman_game_logic.c,
+ * hangman_game_record.c, hangman_solver.c and hangman_strategy.c in the
+ * same build; link with -pthread.
+ */
+
+#include "hangman_core.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EVALUATOR_CHUNK       8
+#define EVALUATOR_MAX_THREADS 1024
+#define EVALUATOR_CACHE_LINE  64
+
+#define RANGE_PACK(begin, end) (((uint64_t)(begin) << 32) | (uint32_t)(end))
+#define RANGE_BEGIN(range)     ((uint32_t)((range) >> 32))
+#define RANGE_END(range)       ((uint32_t)(range))
+
+typedef struct Evaluator Evaluator;
+
+/* One per thread, padded to a cache line so range updates never contend with a neighbour. */
+typedef struct {
+    _Alignas(EVALUATOR_CACHE_LINE) _Atomic uint64_t range;
+    pthread_t thread;
+    Evaluator *evaluator;
+    int index;
+    EvaluationStats stats;
+} EvaluatorWorker;
+
+struct Evaluator {
+    const EvaluationConfig *config;
+    WordScore *scores;
+    EvaluatorWorker *workers;
+    int workerCount;
+};
+
+/**
+ * @brief Takes up to EVALUATOR_CHUNK jobs from the front of the worker's own range
+ * @return false when the range is empty
+ */
+static bool PopJobs(EvaluatorWorker *worker, uint32_t *begin, uint32_t *end) {
+    uint64_t range = atomic_load_explicit(&worker->range, memory_order_acquire);
+    for (;;) {
+        uint32_t first = RANGE_BEGIN(range), last = RANGE_END(range);
+        if (first >= last) return false;
+
+        uint32_t split = (last - first > EVALUATOR_CHUNK) ? first + EVALUATOR_CHUNK : last;
+        if (atomic_compare_exchange_weak_explicit(&worker->range, &range, RANGE_PACK(split, last),
+                                                  memory_order_acq_rel, memory_order_acquire)) {
+            *begin = first;
+            *end = split;
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief Moves the back half of some other worker's range into this worker's range
+ * @return false when no other worker has more than one job left
+ */
+static bool StealJobs(EvaluatorWorker *thief) {
+    Evaluator *evaluator = thief->evaluator;
+    for (int offset = 1; offset < evaluator->workerCount; offset++) {
+        EvaluatorWorker *victim = &evaluator->workers[(thief->index + offset) % evaluator->workerCount];
+        uint64_t range = atomic_load_explicit(&victim->range, memory_order_acquire);
+        for (;;) {
+            uint32_t first = RANGE_BEGIN(range), last = RANGE_END(range);
+            if (last <= first + 1) break;
+
+            uint32_t split = first + (last - first) / 2;
+            if (atomic_compare_exchange_weak_explicit(&victim->range, &range, RANGE_PACK(first, split),
+                                                      memory_order_acq_rel, memory_order_acquire)) {
+                atomic_store_explicit(&thief->range, RANGE_PACK(split, last), memory_order_release);
+                thief->stats.steals++;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Plays every seeded round of one (word, strategy) job
+ */
+static void RunJob(EvaluatorWorker *worker, StrategyContext *context, uint32_t job) {
+    const EvaluationConfig *config = worker->evaluator->config;
+    uint32_t word = job / (uint32_t)config->strategyCount;
+    int strategy = (int)(job % (uint32_t)config->strategyCount);
+
+    WordScore score = {0, 0, 0};
+    for (int round = 0; round < config->seedsPerWord; round++) {
+        GameState game;
+        context->rng = SeedRng(DeriveSeed(config->seed, word, (uint64_t)strategy, (uint64_t)round));
+        StartGameWithWord(&game, config->words, word, &context->rng);
+        worker->stats.guesses += (uint64_t)PlayGame(&game, &config->strategies[strategy], context, NULL);
+
+        score.plays++;
+        score.wins += game.isWin;
+        score.misses += (uint32_t)game.failedAttempts;
+    }
+    worker->evaluator->scores[job] = score;
+
+    worker->stats.games += score.plays;
+    worker->stats.wins += score.wins;
+    worker->stats.misses += score.misses;
+}
+
+static void *EvaluatorThread(void *argument) {
+    EvaluatorWorker *worker = argument;
+    const EvaluationConfig *config = worker->evaluator->config;
+    StrategyContext context = {SeedRng(0), &config->words->alphabet, config->solver, {0}};
+    if (context.solver && !InitializeSolverScratch(&context.scratch, context.solver)) return NULL;
+
+    uint32_t begin, end;
+    do {
+        while (PopJobs(worker, &begin, &end)) {
+            for (uint32_t job = begin; job < end; job++) RunJob(worker, &context, job);
+        }
+    } while (StealJobs(worker));
+
+    FreeSolverScratch(&context.scratch);
+    return worker;
+}
+
+/**
+ * @brief Plays every word against every configured strategy on threadCount threads
+ *
+ * scores must hold wordCount * strategyCount entries and is filled in
+ * word-major order: scores[word * strategyCount + strategy].
+ * @return false if the configuration is unusable or a thread could not start
+ */
+bool RunEvaluation(const EvaluationConfig *config, WordScore *scores, EvaluationStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    uint64_t jobCount = (uint64_t)config->words->wordCount * (uint64_t)config->strategyCount;
+    if (jobCount == 0 || jobCount > UINT32_MAX || config->seedsPerWord <= 0) return false;
+
+    int workerCount = config->threadCount;
+    if (workerCount < 1) workerCount = 1;
+    if (workerCount > EVALUATOR_MAX_THREADS) workerCount = EVALUATOR_MAX_THREADS;
+    if ((uint64_t)workerCount > jobCount) workerCount = (int)jobCount;
+
+    EvaluatorWorker *workers = aligned_alloc(EVALUATOR_CACHE_LINE, (size_t)workerCount * sizeof(EvaluatorWorker));
+    if (!workers) return false;
+    memset(workers, 0, (size_t)workerCount * sizeof(EvaluatorWorker));
+    memset(scores, 0, (size_t)jobCount * sizeof(WordScore));
+
+    Evaluator evaluator = {config, scores, workers, workerCount};
+    for (int i = 0; i < workerCount; i++) {
+        uint32_t first = (uint32_t)(jobCount * (uint64_t)i / (uint64_t)workerCount);
+        uint32_t last = (uint32_t)(jobCount * (uint64_t)(i + 1) / (uint64_t)workerCount);
+        atomic_init(&workers[i].range, RANGE_PACK(first, last));
+        workers[i].evaluator = &evaluator;
+        workers[i].index = i;
+    }
+
+    /* Worker 0 runs on the calling thread. */
+    int started = 1;
+    bool ok = true;
+    for (; started < workerCount; started++) {
+        if (pthread_create(&workers[started].thread, NULL, EvaluatorThread, &workers[started]) != 0) {
+            ok = false;
+            break;
+        }
+    }
+    ok = (EvaluatorThread(&workers[0]) != NULL) && ok;
+
+    for (int i = 0; i < workerCount; i++) {
+        void *result = &workers[i];
+        if (i > 0 && i < started) pthread_join(workers[i].thread, &result);
+        ok = ok && result != NULL;
+
+        stats->games += workers[i].stats.games;
+        stats->wins += workers[i].stats.wins;
+        stats->misses += workers[i].stats.misses;
+        stats->guesses += workers[i].stats.guesses;
+        stats->steals += workers[i].stats.steals;
+    }
+
+    free(workers);
+    return ok;
+}
@@ -3,172 +3,246 @@
  * @brief Core game logic: initialization, guessing, state checks
  */
 
-#include "hangman_types.h"
+#include "hangman_core.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
-#include <time.h>
 #include <stdbool.h>
 
 /**
- * @brief Loads word entries from file in "topic:word" format
+ * @brief Initializes the revealed mask and per-letter position masks from secretSymbols
+ *
+ * Marks cannot be guessed, so their positions are revealed from the start.
  */
-int LoadWordList(const char *filename, WordEntry *wordList, int maxWords) {
-    FILE *file = fopen(filename, "r");
-    if (!file) return 0;
-
-    char buffer[300];
-    int count = 0;
-    while (fgets(buffer, sizeof(buffer), file) && count < maxWords) {
-        buffer[strcspn(buffer, "\r\n")] = '\0';
-        if (strlen(buffer) == 0) continue;
-        char *sep = strchr(buffer, ':');
-        if (sep) {
-            *sep = '\0';
-            strncpy(wordList[count].topic, buffer, MAX_WORD_LENGTH - 1);
-            wordList[count].topic[MAX_WORD_LENGTH - 1] = '\0';
-            strncpy(wordList[count].word, sep + 1, MAX_WORD_LENGTH - 1);
-            wordList[count].word[MAX_WORD_LENGTH - 1] = '\0';
-            count++;
+void InitializeGuessedWord(GameState *game, const Alphabet *alphabet) {
+    game->uniqueLetterCount = 0;
+    game->alphaPositionsTotal = 0;
+    game->revealedMask = 0;
+    memset(game->letterPositions, 0, sizeof(game->letterPositions));
+
+    for (int i = 0; i < game->wordLength; i++) {
+        int li = alphabet->symbolLetter[game->secretSymbols[i]];
+        if (li != ALPHABET_MARK) {
+            if (!game->letterPositions[li]) game->uniqueLetterCount++;
+            game->letterPositions[li] |= 1ull << i;
+            game->alphaPositionsTotal++;
+        } else {
+            game->revealedMask |= 1ull << i;
         }
     }
-    fclose(file);
-    return count;
+    game->remainingLetters = game->alphaPositionsTotal;
 }
 
 /**
- * @brief Initializes guessed word and mask from secret word
+ * @brief Marks positions as shown
+ * @return number of newly revealed positions
  */
-void InitializeGuessedWord(const char *secretWord, char *guessedWord, bool *revealedMask, int *uniqueLetterCount) {
-    int length = strlen(secretWord);
-    *uniqueLetterCount = 0;
-    bool letterPresent[26] = {false};
-
-    for (int i = 0; i < length; i++) {
-        char c = secretWord[i];
-        if (isalpha((unsigned char)c)) {
-            guessedWord[i] = '_';
-            revealedMask[i] = false;
-            char lc = tolower(c);
-            if (!letterPresent[lc - 'a']) {
-                letterPresent[lc - 'a'] = true;
-                (*uniqueLetterCount)++;
-            }
-        } else {
-            guessedWord[i] = c;
-            revealedMask[i] = true;
-        }
+static int RevealPositions(GameState *game, uint64_t positions) {
+    positions &= ~game->revealedMask;
+    game->revealedMask |= positions;
+    int revealed = __builtin_popcountll(positions);
+    game->remainingLetters -= revealed;
+    return revealed;
+}
+
+/**
+ * @brief Position of the n-th (0-based) set bit of mask
+ */
+static int NthSetBit(uint64_t mask, uint32_t n) {
+    while (n--) mask &= mask - 1;
+    return __builtin_ctzll(mask);
+}
+
+/**
+ * @brief Reveals revealCount distinct hidden positions chosen uniformly
+ *
+ * Samples without replacement from the hidden-position mask, so it never
+ * retries and reveals exactly min(revealCount, hidden positions) letters.
+ */
+void RandomlyRevealLetters(GameState *game, int revealCount, Rng *rng) {
+    uint64_t lengthMask = (game->wordLength >= 64) ? ~0ull : (1ull << game->wordLength) - 1;
+    uint64_t hidden = ~game->revealedMask & lengthMask;
+    for (; revealCount > 0 && hidden; revealCount--) {
+        int pos = NthSetBit(hidden, RandomBelow(rng, (uint32_t)__builtin_popcountll(hidden)));
+        hidden &= ~(1ull << pos);
+        game->correctGuessCount += RevealPositions(game, 1ull << pos);
     }
-    guessedWord[length] = '\0';
 }
 
 /**
- * @brief Randomly reveals some letters
+ * @brief Checks win/lose condition from the running counters
+ *
+ * O(1): remainingLetters and livesRemaining are maintained by the reveal
+ * and guess paths, so hosts need not call this on frames without input.
  */
-void RandomlyRevealLetters(const char *secretWord, char *guessedWord, bool *revealedMask, int revealCount, int *correctGuessCount) {
-    int length = strlen(secretWord);
-    int attempts = 0;
-    while (revealCount > 0 && attempts < 1000) {
-        int pos = rand() % length;
-        if (!revealedMask[pos] && isalpha((unsigned char)secretWord[pos])) {
-            guessedWord[pos] = tolower(secretWord[pos]);
-            revealedMask[pos] = true;
-            (*correctGuessCount)++;
-            revealCount--;
-        }
-        attempts++;
+void CheckGameOver(GameState *game) {
+    if (game->remainingLetters == 0) {
+        game->isGameOver = true;
+        game->isWin = true;
+    } else if (game->livesRemaining <= 0) {
+        game->isGameOver = true;
+        game->isWin = false;
     }
 }
 
 /**
- * @brief Initializes full game state with random word
+ * @brief Copies word idx into game and sets up its masks, with nothing guessed or revealed
  */
-void InitializeGame(const WordEntry *wordList, int wordCount, char *topic, char *secretWord,
-                    char *guessedWord, bool *revealedMask, int *uniqueLetterCount,
-                    int *correctGuessCount, int *failedAttempts, bool *isGameOver,
-                    bool *isWin, bool *guessedLetters, KeyboardKey *keys, int keyCount,
-                    int *alphaPositionsTotal) {
-    int idx = rand() % wordCount;
-    strncpy(topic, wordList[idx].topic, MAX_WORD_LENGTH - 1);
-    topic[MAX_WORD_LENGTH - 1] = '\0';
-    strncpy(secretWord, wordList[idx].word, MAX_WORD_LENGTH - 1);
-    secretWord[MAX_WORD_LENGTH - 1] = '\0';
-
-    int len = strlen(secretWord);
-    for (int i = 0; i < len; i++) secretWord[i] = tolower(secretWord[i]);
-
-    InitializeGuessedWord(secretWord, guessedWord, revealedMask, uniqueLetterCount);
+static void LoadSecretWord(GameState *game, const WordList *words, uint32_t idx) {
+    game->wordIndex = idx;
+    strncpy(game->topic, WordListTopic(words, idx), MAX_WORD_LENGTH - 1);
+    game->topic[MAX_WORD_LENGTH - 1] = '\0';
+
+    /* Dictionary words are stored as alphabet symbols already (see LoadWordListFromMemory). */
+    int len = words->entries[idx].wordLength;
+    memcpy(game->secretSymbols, WordListSymbols(words, idx), (size_t)len);
+    game->wordLength = len;
+    game->letterCount = words->alphabet.letterCount;
+
+    InitializeGuessedWord(game, &words->alphabet);
+}
 
+/**
+ * @brief Initializes full game state for a given dictionary word
+ *
+ * Only rng is used for the hint reveals, so this is safe to call from
+ * many threads with one Rng each.
+ */
+void StartGameWithWord(GameState *game, const WordList *words, uint32_t idx, Rng *rng) {
+    LoadSecretWord(game, words, idx);
+
+    int len = game->wordLength;
     int revealCount = (len <= 6) ? 2 : 3;
     if (len < 5) revealCount = 1;
 
-    *correctGuessCount = 0;
-    RandomlyRevealLetters(secretWord, guessedWord, revealedMask, revealCount, correctGuessCount);
+    game->correctGuessCount = 0;
+    game->failedAttempts = 0;
+    game->livesRemaining = MAX_TRIES;
+    game->isGameOver = false;
+    game->isWin = false;
+    game->guessedMask = 0;
+
+    RandomlyRevealLetters(game, revealCount, rng);
+    CheckGameOver(game);
+}
 
-    *failedAttempts = 0;
-    *isGameOver = false;
-    *isWin = false;
-    memset(guessedLetters, 0, 26 * sizeof(bool));
+/**
+ * @brief Starts the round a seeded initializer produces once it has drawn word idx
+ *
+ * Word selection draws from the start of the seed's stream with
+ * RandomBelow, and the reveals always start after its first draw however
+ * many the selection took, so (seed, idx) alone rebuilds any round,
+ * filtered or not. Used by the initializers and by replay.
+ */
+void StartSeededGame(GameState *game, const WordList *words, uint32_t idx, uint64_t seed) {
+    Rng rng = SeedRng(seed);
+    NextRandom(&rng);
+    StartGameWithWord(game, words, idx, &rng);
+    game->seed = seed;
+}
 
-    for (int i = 0; i < keyCount; i++) keys[i].isPressed = false;
+/**
+ * @brief Initializes full game state with a word chosen by seed
+ */
+void InitializeGame(GameState *game, const WordList *words, uint64_t seed) {
+    Rng rng = SeedRng(seed);
+    uint32_t idx = RandomBelow(&rng, words->wordCount);
+    StartSeededGame(game, words, idx, seed);
+}
 
-    *alphaPositionsTotal = 0;
-    for (int i = 0; i < len; i++) {
-        if (isalpha((unsigned char)secretWord[i])) (*alphaPositionsTotal)++;
-    }
+/**
+ * @brief Initializes game state with a word matching filter, chosen by seed
+ * @return false if no word matches (game is left untouched)
+ */
+bool InitializeFilteredGame(GameState *game, const WordList *words, const WordIndex *index,
+                            const WordFilter *filter, uint64_t seed) {
+    Rng rng = SeedRng(seed);
+    uint32_t idx;
+    if (!SelectWord(index, filter, &rng, &idx)) return false;
+
+    StartSeededGame(game, words, idx, seed);
+    return true;
 }
 
 /**
  * @brief Processes a single letter guess
- * @return true if correct guess
+ * @param letter letter index in the word list's alphabet
+ * @return outcome of the guess; only GUESS_HIT and GUESS_MISS change the state
  */
-bool ProcessGuess(char letter, const char *secretWord, char *guessedWord, bool *revealedMask,
-                  bool *guessedLetters, int *correctGuessCount, int *failedAttempts,
-                  KeyboardKey *keys, int keyCount) {
-    int li = letter - 'a';
-    if (li < 0 || li >= 26 || guessedLetters[li]) return false;
-
-    guessedLetters[li] = true;
-
-    for (int i = 0; i < keyCount; i++) {
-        if (tolower(keys[i].letter) == letter) {
-            keys[i].isPressed = true;
-            break;
-        }
-    }
+GuessResult ProcessGuess(GameState *game, int letter) {
+    if (game->isGameOver) return GUESS_GAME_OVER;
 
-    bool found = false;
-    int len = strlen(secretWord);
-    for (int i = 0; i < len; i++) {
-        if (tolower(secretWord[i]) == letter && !revealedMask[i]) {
-            guessedWord[i] = letter;
-            revealedMask[i] = true;
-            (*correctGuessCount)++;
-            found = true;
-        }
+    int li = letter;
+    if (li < 0 || li >= game->letterCount) return GUESS_INVALID;
+    if ((game->guessedMask >> li) & 1u) return GUESS_REPEATED;
+
+    game->guessedMask |= 1ull << li;
+
+    int revealed = RevealPositions(game, game->letterPositions[li]);
+    game->correctGuessCount += revealed;
+
+    bool found = revealed > 0;
+    if (!found) {
+        game->failedAttempts++;
+        game->livesRemaining--;
     }
 
-    if (!found) (*failedAttempts)++;
+    CheckGameOver(game);
+    return found ? GUESS_HIT : GUESS_MISS;
+}
 
-    return found;
+/**
+ * @brief Reduces game to its PackedGame record
+ */
+void PackGameState(const GameState *game, PackedGame *packed) {
+    memset(packed, 0, sizeof(*packed));
+    packed->seed = game->seed;
+    packed->guessedMask = game->guessedMask;
+    packed->revealedMask = game->revealedMask;
+    packed->wordIndex = game->wordIndex;
+    packed->wordLength = (uint8_t)game->wordLength;
+    packed->failedAttempts = (uint8_t)game->failedAttempts;
 }
 
 /**
- * @brief Checks win/lose condition
+ * @brief Rebuilds the full state of a packed game from the word list it was played with
+ *
+ * Counters and the game-over flags are recomputed from the masks. Every
+ * position of a guessed letter must be shown and every guessed letter
+ * absent from the word must be among the misses, so a record from another
+ * word list is rejected rather than resumed.
+ * @return false if the record does not fit words (game then holds no usable round)
  */
-void CheckGameOver(const bool *revealedMask, int wordLength, int alphaTotal,
-                   int failedAttempts, bool *isGameOver, bool *isWin) {
-    int revealedAlpha = 0;
-    for (int i = 0; i < wordLength; i++) {
-        if (revealedMask[i] && isalpha((unsigned char)revealedMask[i])) revealedAlpha++;
+bool RestoreGameState(GameState *game, const WordList *words, const PackedGame *packed) {
+    if (packed->wordIndex >= words->wordCount) return false;
+    LoadSecretWord(game, words, packed->wordIndex);
+
+    uint64_t lengthMask = (game->wordLength >= 64) ? ~0ull : (1ull << game->wordLength) - 1;
+    uint64_t letterMask = (game->letterCount >= 64) ? ~0ull : (1ull << game->letterCount) - 1;
+    if (game->wordLength != packed->wordLength || (packed->revealedMask & ~lengthMask) ||
+        (packed->guessedMask & ~letterMask)) {
+        return false;
     }
 
-    if (revealedAlpha == alphaTotal) {
-        *isGameOver = true;
-        *isWin = true;
-    } else if (failedAttempts >= MAX_TRIES) {
-        *isGameOver = true;
-        *isWin = false;
+    int absentLetters = 0;
+    for (uint64_t guessed = packed->guessedMask; guessed; guessed &= guessed - 1) {
+        uint64_t positions = game->letterPositions[__builtin_ctzll(guessed)];
+        if (!positions) absentLetters++;
+        if (positions & ~packed->revealedMask) return false;
     }
+    int failedAttempts = packed->failedAttempts;
+    if (failedAttempts < absentLetters || failedAttempts > __builtin_popcountll(packed->guessedMask) ||
+        failedAttempts > MAX_TRIES) {
+        return false;
+    }
+
+    game->seed = packed->seed;
+    game->guessedMask = packed->guessedMask;
+    game->correctGuessCount = RevealPositions(game, packed->revealedMask);
+    game->failedAttempts = failedAttempts;
+    game->livesRemaining = MAX_TRIES - failedAttempts;
+    game->isGameOver = false;
+    game->isWin = false;
+    CheckGameOver(game);
+    return true;
 }
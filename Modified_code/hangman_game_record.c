@@ -0,0 +1,328 @@
+/**
+ * @file hangman_game_record.c
+ * @brief Append-only binary game log: writer, mapped reader and replay
+ *
+ * Layout (little-endian): GameLogHeader, then one GameRecord per game,
+ * each followed by its packed guesses and padded to 8 bytes. Only the
+ * seed and word id are stored for setup; StartSeededGame rebuilds the
+ * revealed letters from them, so a record is 32 bytes plus 4 per guess.
+ * Each game is written with one call as its round ends, so a crash loses
+ * at most the round in progress. A torn last record is ignored by the
+ * reader and cut off when the log is next opened for appending, so later
+ * records stay aligned.
+ * Requires hangman_word_list.c and hangman_game_logic.c in the same build.
+ */
+
+#include "hangman_core.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define ftruncate _chsize
+#else
+#include <unistd.h>
+#endif
+
+#define GAME_LOG_MAGIC       "HGMLOG"
+#define GAME_LOG_VERSION     2
+#define GAME_LOG_BUFFER_SIZE (64 * 1024)
+#define GAME_LOG_MAX_ELAPSED 0xFFFFFFu
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+} GameLogHeader;
+
+static size_t GameRecordSize(uint32_t guessCount) {
+    return sizeof(GameRecord) + (((size_t)guessCount * sizeof(uint32_t) + 7u) & ~(size_t)7u);
+}
+
+static GameLogHeader MakeGameLogHeader(void) {
+    GameLogHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GAME_LOG_MAGIC, sizeof(GAME_LOG_MAGIC));
+    header.version = GAME_LOG_VERSION;
+    header.headerSize = (uint32_t)sizeof(GameLogHeader);
+    return header;
+}
+
+/**
+ * @brief Id records are tagged with; records only replay against the same list
+ *
+ * Computed once when the list is loaded (or read from the dictionary
+ * header), so this is O(1).
+ */
+uint32_t GameLogDictionaryId(const WordList *words) {
+    return words->dictionaryId;
+}
+
+/**
+ * @brief Finds where the complete records of an existing log end
+ *
+ * Walks the record headers the way NextGameRecord does, so the end found
+ * is exactly where a reader stops.
+ * @return false if the file holds something other than a game log
+ */
+static bool FindGameLogEnd(FILE *file, const GameLogHeader *expected, long *end) {
+    *end = 0;
+    if (fseek(file, 0, SEEK_END) != 0) return false;
+    long size = ftell(file);
+    if (size < 0 || fseek(file, 0, SEEK_SET) != 0) return false;
+    if (size == 0) return true;
+
+    GameLogHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(&header, expected, sizeof(header)) != 0) return false;
+
+    long offset = (long)sizeof(header);
+    GameRecord record;
+    while (size - offset >= (long)sizeof(record) && fread(&record, sizeof(record), 1, file) == 1) {
+        long recordSize = (long)GameRecordSize(record.guessCount);
+        if (record.guessCount > MAX_ALPHABET_LETTERS || size - offset < recordSize) break;
+        offset += recordSize;
+        if (fseek(file, offset, SEEK_SET) != 0) break;
+    }
+    *end = offset;
+    return true;
+}
+
+/**
+ * @brief Opens filename for appending, writing the header if the file is new
+ *
+ * A torn record left by a run that died mid-write is cut off first.
+ * @return false if the file cannot be opened or belongs to another format;
+ * the log is then left closed and every other call is a no-op
+ */
+bool OpenGameLog(GameLog *log, const char *filename, const WordList *words) {
+    memset(log, 0, sizeof(*log));
+    GameLogHeader expected = MakeGameLogHeader();
+
+    long end = 0;
+    FILE *existing = fopen(filename, "rb");
+    if (existing) {
+        bool isLog = FindGameLogEnd(existing, &expected, &end);
+        fclose(existing);
+        if (!isLog) return false;
+    }
+
+    log->buffer = malloc(GAME_LOG_BUFFER_SIZE);
+    log->file = log->buffer ? fopen(filename, "ab") : NULL;
+    if (!log->file) {
+        free(log->buffer);
+        log->buffer = NULL;
+        return false;
+    }
+    setvbuf(log->file, NULL, _IONBF, 0);
+
+    /* The position of an append stream is unspecified until the first write, so seek explicitly */
+    bool ok = fseek(log->file, 0, SEEK_END) == 0;
+    long size = ok ? ftell(log->file) : -1;
+    if (ok && size != end) ok = ftruncate(fileno(log->file), end) == 0 && fseek(log->file, 0, SEEK_END) == 0;
+    if (!ok) {
+        fclose(log->file);
+        free(log->buffer);
+        memset(log, 0, sizeof(*log));
+        return false;
+    }
+
+    if (end == 0) {
+        memcpy(log->buffer, &expected, sizeof(expected));
+        log->used = sizeof(expected);
+    }
+    log->dictionaryId = GameLogDictionaryId(words);
+    return true;
+}
+
+/**
+ * @brief Tags records started from now on with another word list's id (after a reload)
+ */
+void SetGameLogDictionary(GameLog *log, uint32_t dictionaryId) {
+    log->dictionaryId = dictionaryId;
+}
+
+/**
+ * @brief Starts recording a freshly initialized round
+ * @param startedAt wall-clock start, seconds since the Unix epoch
+ */
+void BeginGameRecord(GameLog *log, const GameState *game, uint64_t startedAt) {
+    if (!log->file) return;
+
+    memset(&log->current, 0, sizeof(log->current));
+    log->current.seed = game->seed;
+    log->current.startedAt = startedAt;
+    log->current.wordIndex = game->wordIndex;
+    log->current.dictionaryId = log->dictionaryId;
+    log->recording = true;
+}
+
+/**
+ * @brief Appends a guess that changed the game (GUESS_HIT or GUESS_MISS)
+ * @param elapsedMs time since the round started, saturated at about 4.6 hours
+ */
+void RecordGuess(GameLog *log, int letter, GuessResult result, uint32_t elapsedMs) {
+    if (!log->recording || (result != GUESS_HIT && result != GUESS_MISS)) return;
+    if (letter < 0 || letter >= MAX_ALPHABET_LETTERS || log->current.guessCount >= MAX_ALPHABET_LETTERS) return;
+
+    if (elapsedMs > GAME_LOG_MAX_ELAPSED) elapsedMs = GAME_LOG_MAX_ELAPSED;
+    log->guesses[log->current.guessCount++] =
+        (elapsedMs << 8) | (result == GUESS_HIT ? GAME_RECORD_HIT : 0u) | (uint32_t)letter;
+}
+
+/**
+ * @brief Writes the buffered bytes to disk
+ *
+ * Bytes a failed write leaves behind stay buffered and are retried first
+ * on the next call, so records are neither lost nor written out of order.
+ * @return false if some bytes could not be written
+ */
+bool FlushGameLog(GameLog *log) {
+    if (!log->file || log->used == 0) return true;
+
+    size_t written = fwrite(log->buffer, 1, log->used, log->file);
+    log->used -= written;
+    memmove(log->buffer, log->buffer + written, log->used);
+    if (log->used) clearerr(log->file);
+    return log->used == 0;
+}
+
+/**
+ * @brief Closes the current record, finished or abandoned, and writes it out
+ * @return false if it could not be written yet (it stays buffered for the
+ * next round) or was dropped because earlier writes kept failing
+ */
+bool EndGameRecord(GameLog *log, const GameState *game, uint32_t durationMs) {
+    if (!log->recording) return true;
+    log->recording = false;
+
+    GameRecord *record = &log->current;
+    record->durationMs = durationMs;
+    record->misses = (uint8_t)game->failedAttempts;
+    record->flags = (game->isGameOver ? GAME_RECORD_FINISHED : 0u) | (game->isWin ? GAME_RECORD_WIN : 0u);
+
+    size_t size = GameRecordSize(record->guessCount);
+    if (log->used + size > GAME_LOG_BUFFER_SIZE && !FlushGameLog(log)) return false;
+
+    unsigned char *out = log->buffer + log->used;
+    memset(out, 0, size);
+    memcpy(out, record, sizeof(*record));
+    memcpy(out + sizeof(*record), log->guesses, (size_t)record->guessCount * sizeof(uint32_t));
+    log->used += size;
+    return FlushGameLog(log);
+}
+
+/**
+ * @brief Flushes and closes the log
+ *
+ * A round still being recorded is dropped; end it with EndGameRecord first
+ * to keep it as abandoned.
+ */
+void CloseGameLog(GameLog *log) {
+    if (log->file) {
+        FlushGameLog(log);
+        fclose(log->file);
+    }
+    free(log->buffer);
+    memset(log, 0, sizeof(*log));
+}
+
+void CloseGameLogReader(GameLogReader *reader) {
+    free(reader->arena);
+#ifndef WORD_LIST_USE_STDIO
+    if (reader->mapping) munmap(reader->mapping, reader->mappingSize);
+#endif
+    memset(reader, 0, sizeof(*reader));
+}
+
+/**
+ * @brief Maps a game log for sequential reading
+ * @return false if the file is missing or not a game log
+ */
+bool OpenGameLogReader(GameLogReader *reader, const char *filename) {
+    memset(reader, 0, sizeof(*reader));
+
+#ifdef WORD_LIST_USE_STDIO
+    FILE *file = fopen(filename, "rb");
+    if (!file) return false;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    void *image = (size > 0) ? malloc((size_t)size) : NULL;
+    bool ok = image && fread(image, 1, (size_t)size, file) == (size_t)size;
+    fclose(file);
+    if (!ok) {
+        free(image);
+        return false;
+    }
+    reader->arena = image;
+    reader->data = image;
+    reader->size = (size_t)size;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    void *mapping = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) return false;
+
+    posix_madvise(mapping, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+    reader->mapping = mapping;
+    reader->mappingSize = (size_t)info.st_size;
+    reader->data = mapping;
+    reader->size = (size_t)info.st_size;
+#endif
+
+    GameLogHeader expected = MakeGameLogHeader();
+    if (reader->size < sizeof(expected) || memcmp(reader->data, &expected, sizeof(expected)) != 0) {
+        CloseGameLogReader(reader);
+        return false;
+    }
+    reader->offset = sizeof(expected);
+    return true;
+}
+
+/**
+ * @brief Steps to the next record; pointers stay valid until the reader is closed
+ * @return false at the end of the log or at a truncated record
+ */
+bool NextGameRecord(GameLogReader *reader, const GameRecord **record, const uint32_t **guesses) {
+    if (reader->size - reader->offset < sizeof(GameRecord)) return false;
+
+    const GameRecord *next = (const GameRecord *)(reader->data + reader->offset);
+    size_t size = GameRecordSize(next->guessCount);
+    if (next->guessCount > MAX_ALPHABET_LETTERS || reader->size - reader->offset < size) return false;
+
+    *record = next;
+    *guesses = (const uint32_t *)(next + 1);
+    reader->offset += size;
+    return true;
+}
+
+/**
+ * @brief Replays a record into game and checks every guess had the recorded outcome
+ *
+ * The caller must check record->dictionaryId against GameLogDictionaryId
+ * of words once per list.
+ * @return false if the record does not reproduce (corrupt or foreign log)
+ */
+bool ReplayGameRecord(const GameRecord *record, const uint32_t *guesses, const WordList *words, GameState *game) {
+    if (record->wordIndex >= words->wordCount) return false;
+
+    StartSeededGame(game, words, record->wordIndex, record->seed);
+    for (uint32_t i = 0; i < record->guessCount; i++) {
+        uint32_t guess = guesses[i];
+        GuessResult result = ProcessGuess(game, (int)(guess & GAME_RECORD_LETTER));
+        GuessResult expected = (guess & GAME_RECORD_HIT) ? GUESS_HIT : GUESS_MISS;
+        if (result != expected) return false;
+    }
+
+    if (record->flags & GAME_RECORD_FINISHED) {
+        return game->isGameOver && game->isWin == ((record->flags & GAME_RECORD_WIN) != 0);
+    }
+    return !game->isGameOver;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file hangman_glyph_atlas.c
+ * @brief Glyph atlas: text rendering without per-frame string formatting
+ *
+ * Symbols are rasterized one codepoint at a time, without text shaping,
+ * so scripts that join or reorder characters show them side by side.
+ */
+
+#include "hangman_types.h"
+
+#define LETTER_FONT_SIZE 30
+
+/**
+ * @brief Loads the alphabet's font for its codepoints, or falls back to raylib's default font
+ */
+static void LoadLetterFont(GlyphAtlas *atlas, const Alphabet *alphabet) {
+    atlas->letterFont = GetFontDefault();
+    atlas->ownsLetterFont = false;
+    if (!alphabet->fontFile || !FileExists(alphabet->fontFile)) return;
+
+    int codepoints[GLYPH_COUNT + 2 * MAX_ALPHABET_SYMBOLS];
+    int count = 0;
+    for (int c = GLYPH_FIRST; c <= GLYPH_LAST; c++) codepoints[count++] = c;
+    for (int s = 0; s < alphabet->symbolCount; s++) {
+        codepoints[count++] = (int)alphabet->codepoints[s];
+        if (alphabet->upperCodepoints[s]) codepoints[count++] = (int)alphabet->upperCodepoints[s];
+    }
+
+    // raylib hands back its default font when the file cannot be loaded; that one must not be unloaded
+    Font font = LoadFontEx(alphabet->fontFile, LETTER_FONT_SIZE, codepoints, count);
+    if (font.texture.id == 0 || font.texture.id == atlas->letterFont.texture.id) return;
+    SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+    atlas->letterFont = font;
+    atlas->ownsLetterFont = true;
+}
+
+/**
+ * @brief Rasterizes one codepoint of font at the packing cursor and advances it
+ *
+ * The cell spans the glyph's ink as well as its advance, so combining
+ * marks, which draw left of the pen and advance by nothing, stay visible.
+ * @return the glyph's rectangle in the atlas
+ */
+static Rectangle PackCodepoint(Font font, int codepoint, int fontSize, int *x, int *y) {
+    GlyphInfo info = GetGlyphInfo(font, codepoint);
+    Rectangle ink = GetGlyphAtlasRec(font, codepoint);
+    float scale = (float)fontSize / (float)font.baseSize;
+    float advance = info.advanceX ? (float)info.advanceX : ink.width + (float)info.offsetX;
+    float left = info.offsetX < 0 ? (float)info.offsetX : 0.0f;
+    float right = (float)info.offsetX + ink.width > advance ? (float)info.offsetX + ink.width : advance;
+    int width = (int)((right - left) * scale + 0.5f);
+    int height = fontSize + fontSize / 4;
+
+    if (*x + width > GLYPH_ATLAS_WIDTH) {
+        *x = 0;
+        *y += height + 2;
+    }
+    DrawTextCodepoint(font, codepoint, (Vector2){(float)*x - left * scale, (float)*y}, (float)fontSize, WHITE);
+    Rectangle glyph = {(float)*x, (float)*y, (float)width, (float)height};
+    *x += width + 2;
+    return glyph;
+}
+
+/**
+ * @brief Rasterizes printable ASCII at every GlyphSize into one texture,
+ * followed by the alphabet's symbols and keyboard labels
+ */
+void LoadGlyphAtlas(GlyphAtlas *atlas, const Alphabet *alphabet) {
+    static const int sizes[GLYPH_SIZE_COUNT] = {20, 22, 30};
+    LoadLetterFont(atlas, alphabet);
+    atlas->texture = LoadRenderTexture(GLYPH_ATLAS_WIDTH, GLYPH_ATLAS_HEIGHT);
+
+    BeginTextureMode(atlas->texture);
+    ClearBackground(BLANK);
+    int x = 0, y = 0;
+    for (int size = 0; size < GLYPH_SIZE_COUNT; size++) {
+        atlas->fontSizes[size] = sizes[size];
+        for (int c = GLYPH_FIRST; c <= GLYPH_LAST; c++) {
+            char text[2] = {(char)c, '\0'};
+            int width = MeasureText(text, sizes[size]);
+            if (x + width > GLYPH_ATLAS_WIDTH) {
+                x = 0;
+                y += sizes[size] + 2;
+            }
+            DrawText(text, x, y, sizes[size], WHITE);
+            atlas->glyphs[size][c - GLYPH_FIRST] = (Rectangle){(float)x, (float)y, (float)width, (float)sizes[size]};
+            x += width + 2;
+        }
+        x = 0;
+        y += sizes[size] + 2;
+    }
+
+    for (int size = 0; size < GLYPH_SIZE_COUNT; size++) {
+        for (int s = 0; s < alphabet->symbolCount; s++) {
+            atlas->symbolGlyphs[size][s] =
+                PackCodepoint(atlas->letterFont, (int)alphabet->codepoints[s], sizes[size], &x, &y);
+        }
+        x = 0;
+        y += sizes[size] + sizes[size] / 4 + 2;
+    }
+
+    for (int letter = 0; letter < alphabet->letterCount; letter++) {
+        uint32_t label = alphabet->upperCodepoints[letter] ? alphabet->upperCodepoints[letter]
+                                                             : alphabet->codepoints[letter];
+        atlas->keyGlyphs[letter] = PackCodepoint(atlas->letterFont, (int)label, sizes[GLYPH_SIZE_22], &x, &y);
+    }
+    EndTextureMode();
+}
+
+void UnloadGlyphAtlas(GlyphAtlas *atlas) {
+    UnloadRenderTexture(atlas->texture);
+    if (atlas->ownsLetterFont) UnloadFont(atlas->letterFont);
+    atlas->ownsLetterFont = false;
+}
+
+/**
+ * @brief Draws one atlas rectangle with its top-left corner at (x, y)
+ */
+void DrawAtlasGlyph(const GlyphAtlas *atlas, Rectangle glyph, int x, int y, Color color) {
+    // Render textures are stored bottom-up: flip the source rectangle
+    Rectangle source = {glyph.x, GLYPH_ATLAS_HEIGHT - glyph.y - glyph.height, glyph.width, -glyph.height};
+    DrawTextureRec(atlas->texture.texture, source, (Vector2){(float)x, (float)y}, color);
+}
+
+/**
+ * @brief Draws one character from the atlas
+ * @return horizontal advance, matching DrawText spacing
+ */
+int DrawGlyph(const GlyphAtlas *atlas, GlyphSize size, char c, int x, int y, Color color) {
+    if (c < GLYPH_FIRST || c > GLYPH_LAST) c = '?';
+    Rectangle glyph = atlas->glyphs[size][c - GLYPH_FIRST];
+    DrawAtlasGlyph(atlas, glyph, x, y, color);
+    return (int)glyph.width + atlas->fontSizes[size] / 10;
+}
+
+/**
+ * @brief Draws one alphabet symbol from the atlas
+ * @return horizontal advance
+ */
+int DrawSymbol(const GlyphAtlas *atlas, GlyphSize size, uint8_t symbol, int x, int y, Color color) {
+    Rectangle glyph = atlas->symbolGlyphs[size][symbol];
+    DrawAtlasGlyph(atlas, glyph, x, y, color);
+    return (int)glyph.width + atlas->fontSizes[size] / 10;
+}
+
+/**
+ * @brief Draws a string from the atlas
+ * @return x just past the last character
+ */
+int DrawAtlasText(const GlyphAtlas *atlas, GlyphSize size, const char *text, int x, int y, Color color) {
+    for (; *text; text++) x += DrawGlyph(atlas, size, *text, x, y, color);
+    return x;
+}
+
+/**
+ * @brief Draws UTF-8 text: from the atlas when it is plain ASCII, otherwise with the alphabet's font
+ * @return x just past the text
+ */
+int DrawAtlasTextUtf8(const GlyphAtlas *atlas, GlyphSize size, const char *text, int x, int y, Color color) {
+    const char *c = text;
+    while (*c && (unsigned char)*c < 0x80) c++;
+    if (!*c) return DrawAtlasText(atlas, size, text, x, y, color);
+
+    float fontSize = (float)atlas->fontSizes[size];
+    DrawTextEx(atlas->letterFont, text, (Vector2){(float)x, (float)y}, fontSize, fontSize / 10, color);
+    return x + (int)MeasureTextEx(atlas->letterFont, text, fontSize, fontSize / 10).x;
+}
+
+/**
+ * @brief Draws a word stored as alphabet symbols
+ * @return x just past the last symbol
+ */
+int DrawAtlasWord(const GlyphAtlas *atlas, GlyphSize size, const uint8_t *symbols, int count, int x, int y,
+                  Color color) {
+    for (int i = 0; i < count; i++) x += DrawSymbol(atlas, size, symbols[i], x, y, color);
+    return x;
+}
+
+/**
+ * @brief Draws a non-negative integer from the atlas without formatting a string
+ * @return x just past the last digit
+ */
+int DrawAtlasNumber(const GlyphAtlas *atlas, GlyphSize size, int value, int x, int y, Color color) {
+    char digits[12];
+    int count = 0;
+    if (value < 0) value = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    while (count > 0) x += DrawGlyph(atlas, size, digits[--count], x, y, color);
+    return x;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file hangman_input.c
+ * @brief Input stage: typed and clicked letters merged into one ordered queue
+ */
+
+#include "hangman_types.h"
+#include <string.h>
+
+void InitializeInputQueue(InputQueue *queue) {
+    memset(queue, 0, sizeof(*queue));
+}
+
+/**
+ * @brief Appends a guess; used directly for letters that do not come from raylib input
+ */
+void PushInputEvent(InputQueue *queue, int letter, InputSource source, double timestamp) {
+    if (queue->count == INPUT_QUEUE_CAPACITY) return;
+    int tail = (queue->head + queue->count) % INPUT_QUEUE_CAPACITY;
+    queue->events[tail] = (InputEvent){letter, source, timestamp};
+    queue->count++;
+}
+
+/**
+ * @brief Removes the oldest event
+ * @return false if the queue is empty
+ */
+bool PopInputEvent(InputQueue *queue, InputEvent *event) {
+    if (queue->count == 0) return false;
+    *event = queue->events[queue->head];
+    queue->head = (queue->head + 1) % INPUT_QUEUE_CAPACITY;
+    queue->count--;
+    return true;
+}
+
+/**
+ * @brief Drains raylib's character queue and appends the on-screen keyboard click
+ *
+ * Typed letters keep their arrival order; raylib does not say when a click
+ * happened relative to them within one poll, so the click goes last.
+ * All events of a poll share its timestamp, the closest raylib offers.
+ * Typed characters outside the alphabet, and its marks, are ignored.
+ */
+void CollectInputEvents(InputQueue *queue, const Alphabet *alphabet, int mouseLetter) {
+    double now = GetTime();
+
+    int codepoint;
+    while ((codepoint = GetCharPressed()) > 0) {
+        int letter = AlphabetLetter(alphabet, (uint32_t)codepoint);
+        if (letter != NO_LETTER) PushInputEvent(queue, letter, INPUT_SOURCE_KEYBOARD, now);
+    }
+    if (mouseLetter != NO_LETTER) PushInputEvent(queue, mouseLetter, INPUT_SOURCE_MOUSE, now);
+}
+
+/**
+ * @brief Adds one input-to-reveal sample
+ */
+void RecordLatency(LatencyStats *stats, double seconds) {
+    stats->count++;
+    stats->total += seconds;
+    if (seconds > stats->max) stats->max = seconds;
+}
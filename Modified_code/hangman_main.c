@@ -5,122 +5,298 @@
 
 #include "raylib.h"
 #include "hangman_types.h"
+#include "hangman_alphabet.c"
+#include "hangman_word_list.c"
+#include "hangman_dictionary.c"
+#include "hangman_random.c"
+#include "hangman_word_index.c"
 #include "hangman_game_logic.c"   // Note: In real project use .h if split further
+#include "hangman_game_record.c"
+#include "hangman_stats.c"
+#include "hangman_solver.c"
+#include "hangman_difficulty.c"
+#include "hangman_word_watch.c"
+#include "hangman_glyph_atlas.c"
+#include "hangman_profiler.c"
+#include "hangman_audio.c"
+#include "hangman_input.c"
 #include "hangman_ui.c"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
-int main() {
+int main(int argc, char **argv) {
+    // "--seed N" replays the same sequence of rounds; otherwise the clock picks one.
+    // "--player NAME" picks whose statistics are kept; otherwise the login name.
+    // "--profile FILE" records every frame's phase timings and writes them on exit (.json or CSV).
+    uint64_t seed = (uint64_t)time(NULL);
+    const char *player = getenv("USER") ? getenv("USER") : getenv("USERNAME");
+    if (!player || !player[0]) player = "player";
+    const char *profileFile = NULL;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--seed") == 0) seed = strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "--player") == 0) player = argv[i + 1];
+        else if (strcmp(argv[i], "--profile") == 0) profileFile = argv[i + 1];
+    }
+    Rng rng = SeedRng(seed);
+
     InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Hangman Game");
     SetTargetFPS(60);
-    srand((unsigned)time(NULL));
-
-    WordEntry wordList[MAX_WORDS];
-    int wordCount = LoadWordList("words.txt", wordList, MAX_WORDS);
-    if (wordCount == 0) {
-        strcpy(wordList[0].topic, "Fruits"); strcpy(wordList[0].word, "banana");
-        strcpy(wordList[1].topic, "Country"); strcpy(wordList[1].word, "bangladesh");
-        wordCount = 2;
+
+    // words.hgd is the compiled words.txt and starts faster; it is skipped once words.txt is newer
+    WordBundle *dictionary = NULL;
+    if (GetFileModTime("words.hgd") > GetFileModTime("words.txt")) {
+        dictionary = LoadWordBundle("words.hgd");
+        if (!dictionary && IsDictionaryFile("words.hgd")) {
+            fprintf(stderr, "words.hgd: outdated or damaged dictionary, using words.txt\n");
+        }
+    }
+    if (!dictionary) dictionary = LoadWordBundle("words.txt");
+    if (!dictionary) {
+        static const char fallbackWords[] = "Fruits:banana\nCountry:bangladesh\n";
+        WordList words;
+        LoadWordListFromMemory(&words, fallbackWords, sizeof(fallbackWords) - 1);
+        dictionary = CreateWordBundle(&words);
     }
+    if (!dictionary) {
+        CloseWindow();
+        return 1;
+    }
+    WordWatcher watcher;
+    // words.txt is the file people edit: a change is re-parsed, recompiled and used from the next round
+    StartWordWatcher(&watcher, "words.txt", "words.hgd");
+
+    // Keyboard, atlas and input all follow the word list's alphabet
+    const Alphabet *alphabet = &dictionary->words.alphabet;
+    char alphabetName[ALPHABET_NAME_LENGTH];
+    memcpy(alphabetName, alphabet->name, sizeof(alphabetName));
+    Keyboard keyboard;
+    InitializeKeyboard(&keyboard, alphabet);
+
+    // Every round is appended to games.hgr; logging is skipped if it cannot be opened
+    GameLog gameLog;
+    OpenGameLog(&gameLog, "games.hgr", &dictionary->words);
+
+    // Statistics are saved by a background thread at the end of every round
+    StatsTable stats;
+    LoadStats(&stats, "stats.hgs");
+    StatsWriter statsWriter;
+    StartStatsWriter(&statsWriter, "stats.hgs");
+    FindStats(&stats, STATS_PLAYER, player, true);
+
+    // Words are drawn near a target difficulty that follows the player's recent win rate
+    DifficultyTuner tuner;
+    InitializeDifficultyTuner(&tuner, FindStats(&stats, STATS_PLAYER, player, false));
 
-    KeyboardKey keys[26];
-    int keyCount = InitializeKeyboard(keys);
+    GameState game;
+    InitializeGameAtDifficulty(&game, &dictionary->words, &dictionary->difficulty, tuner.target, NextRandom(&rng));
+    double roundStart = GetTime();
+    BeginGameRecord(&gameLog, &game, (uint64_t)time(NULL));
 
-    // Game state
-    char topic[MAX_WORD_LENGTH];
-    char secretWord[MAX_WORD_LENGTH];
-    char guessedWord[MAX_WORD_LENGTH];
-    bool revealedMask[MAX_WORD_LENGTH];
-    int uniqueLetterCount, correctGuessCount, failedAttempts, alphaPositionsTotal;
-    bool isGameOver = false, isWin = false;
-    bool guessedLetters[26] = {false};
+    GlyphAtlas atlas;
+    LoadGlyphAtlas(&atlas, alphabet);
+    UiLayers layers;
+    LoadUiLayers(&layers);
 
-    InitializeGame(wordList, wordCount, topic, secretWord, guessedWord, revealedMask,
-                   &uniqueLetterCount, &correctGuessCount, &failedAttempts, &isGameOver,
-                   &isWin, guessedLetters, keys, keyCount, &alphaPositionsTotal);
+    // Effects are decoded up front; the game loop only restarts preloaded voices
+    SoundBank sounds;
+    LoadSoundBank(&sounds);
+
+    InputQueue inputQueue;
+    InitializeInputQueue(&inputQueue);
+    double pendingTimestamps[INPUT_QUEUE_CAPACITY];
+    int pendingCount = 0;
+    LatencyStats latency = {0, 0.0, 0.0};
+
+    // F3 shows the profiler overlay; timings are only taken while it is shown or --profile was given
+    FrameProfiler profiler;
+    InitializeProfiler(&profiler, profileFile != NULL);
+
+    // Frames are only drawn when something visible changed; otherwise the
+    // loop sleeps in PollInputEvents until the next input event arrives.
+    // While profiling, every frame is drawn so EndDrawing times presentation, not idle waiting.
+    bool eventWaiting = !ProfilerActive(&profiler);
+    if (eventWaiting) EnableEventWaiting();
+    unsigned int dirty = DIRTY_ALL;
+    HoverState hover = {-1, false, false, false};
+    bool wasFocused = IsWindowFocused();
 
     while (!WindowShouldClose()) {
+        if (IsKeyPressed(KEY_F3)) {
+            ToggleProfilerOverlay(&profiler);
+            dirty |= DIRTY_PROFILER;
+        }
+        if (ProfilerActive(&profiler) == eventWaiting) {
+            eventWaiting = !eventWaiting;
+            if (eventWaiting) EnableEventWaiting();
+            else DisableEventWaiting();
+        }
+        if (ProfilerActive(&profiler)) dirty |= DIRTY_PROFILER;
+        BeginProfileFrame(&profiler);
+
         Vector2 mouse = GetMousePosition();
         bool clicked = IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+        bool hoverHint = CheckCollisionPointRec(mouse, HINT_BUTTON_RECT);
+
+        PROFILE_SCOPE(&profiler, PROFILE_INPUT) {
+            int mouseLetter = UpdateKeyboard(&keyboard, mouse, clicked);
+            if (mouseLetter != NO_LETTER) dirty |= DIRTY_KEYBOARD;
+            CollectInputEvents(&inputQueue, alphabet, mouseLetter);
+        }
 
-        char inputLetter = 0;
-        for (int k = 0; k < 26; k++) {
-            if (IsKeyPressed(KEY_A + k)) {
-                inputLetter = 'a' + k;
-                break;
+        if (hoverHint && clicked && dictionary->hintsAvailable && !game.isGameOver) {
+            PROFILE_SCOPE(&profiler, PROFILE_HINT) {
+                int hintLetter = SuggestLetter(&dictionary->solver, &dictionary->scratch, &game);
+                if (hintLetter != NO_LETTER) PushInputEvent(&inputQueue, hintLetter, INPUT_SOURCE_HINT, GetTime());
             }
         }
 
-        char mouseLetter = HandleKeyboardInput(keys, keyCount, mouse, clicked);
-        char letter = mouseLetter ? mouseLetter : inputLetter;
+        // Every queued letter is applied this frame, in arrival order
+        BeginProfilePhase(&profiler, PROFILE_LOGIC);
+        InputEvent event;
+        while (PopInputEvent(&inputQueue, &event)) {
+            GuessResult result = ProcessGuess(&game, event.letter);
+            if (result != GUESS_HIT && result != GUESS_MISS) continue;
+            PlayGuessSound(&sounds, result, &game);
 
-        if (!isGameOver && letter) {
-            ProcessGuess(letter, secretWord, guessedWord, revealedMask, guessedLetters,
-                         &correctGuessCount, &failedAttempts, keys, keyCount);
-        }
+            uint32_t elapsedMs = (uint32_t)((event.timestamp - roundStart) * 1000.0);
+            RecordGuess(&gameLog, event.letter, result, elapsedMs);
+            if (game.isGameOver) {
+                EndGameRecord(&gameLog, &game, elapsedMs);
+                RecordGameStats(&stats, player, &game, elapsedMs);
+                RecordDifficultyResult(&tuner, game.isWin);
+                QueueGameStats(&statsWriter, player, &game, elapsedMs);
+                dirty |= DIRTY_PANEL;
+            }
 
-        CheckGameOver(revealedMask, strlen(secretWord), alphaPositionsTotal,
-                      failedAttempts, &isGameOver, &isWin);
+            MarkKeyPressed(&keyboard, event.letter);
+            pendingTimestamps[pendingCount++] = event.timestamp;
+            dirty |= DIRTY_KEYBOARD;
+            if (result == GUESS_HIT) dirty |= DIRTY_WORD;
+            if (result == GUESS_MISS) dirty |= DIRTY_FIGURE | DIRTY_PANEL;
+            if (game.isGameOver) dirty |= DIRTY_OVERLAY;
+        }
 
         // Restart / Quit buttons
-        Rectangle restartBtn = {720, 40, 220, 42};
-        bool hoverRestart = CheckCollisionPointRec(mouse, restartBtn);
+        bool hoverRestart = CheckCollisionPointRec(mouse, RESTART_BUTTON_RECT);
         if (hoverRestart && clicked) {
-            InitializeGame(wordList, wordCount, topic, secretWord, guessedWord, revealedMask,
-                           &uniqueLetterCount, &correctGuessCount, &failedAttempts, &isGameOver,
-                           &isWin, guessedLetters, keys, keyCount, &alphaPositionsTotal);
+            EndGameRecord(&gameLog, &game, (uint32_t)((GetTime() - roundStart) * 1000.0));
+            // A reloaded word list is only swapped in between rounds
+            if (SwapReloadedWords(&watcher, &dictionary)) {
+                SetGameLogDictionary(&gameLog, dictionary->dictionaryId);
+                alphabet = &dictionary->words.alphabet;
+                if (strcmp(alphabet->name, alphabetName) != 0) {
+                    memcpy(alphabetName, alphabet->name, sizeof(alphabetName));
+                    InitializeKeyboard(&keyboard, alphabet);
+                    UnloadGlyphAtlas(&atlas);
+                    LoadGlyphAtlas(&atlas, alphabet);
+                }
+            }
+            InitializeGameAtDifficulty(&game, &dictionary->words, &dictionary->difficulty, tuner.target,
+                                       NextRandom(&rng));
+            roundStart = GetTime();
+            BeginGameRecord(&gameLog, &game, (uint64_t)time(NULL));
+            ResetKeyboard(&keyboard);
+            dirty = DIRTY_ALL;
         }
+        EndProfilePhase(&profiler, PROFILE_LOGIC);
 
-        Rectangle quitBtn = {720, 100, 220, 42};
-        bool hoverQuit = CheckCollisionPointRec(mouse, quitBtn);
+        bool hoverQuit = CheckCollisionPointRec(mouse, QUIT_BUTTON_RECT);
         if (hoverQuit && clicked) break;
 
-        BeginDrawing();
-        ClearBackground(RAYWHITE);
+        if (keyboard.hoveredKey != hover.hoveredKey) dirty |= DIRTY_HOVER;
+        if (hoverRestart != hover.hoverRestart || hoverQuit != hover.hoverQuit || hoverHint != hover.hoverHint) {
+            dirty |= DIRTY_PANEL;
+        }
+        hover = (HoverState){keyboard.hoveredKey, hoverRestart, hoverQuit, hoverHint};
 
-        // Header
-        DrawRectangle(0, 0, WINDOW_WIDTH, 100, Fade(LIGHTGRAY, 0.08f));
-        DrawText("HANGMAN", 350, 14, 52, DARKBLUE);
-        DrawText(TextFormat("Topic: %s", topic), 30, 52, 20, DARKGRAY);
+        bool isFocused = IsWindowFocused();
+        if (IsWindowResized() || isFocused != wasFocused) dirty = DIRTY_ALL;
+        wasFocused = isFocused;
 
-        // Controls panel
-        DrawRectangle(700, 20, 280, 160, Fade(RAYWHITE, 0.6f));
-        DrawText("Controls", 760, 10, 22, BLUE);
-        DrawRectangleRec(restartBtn, hoverRestart ? SKYBLUE : Fade(LIGHTGRAY, 0.9f));
-        DrawRectangleLinesEx(restartBtn, 2, GRAY);
-        DrawText("Restart (Click)", 760, 52, 20, BLACK);
-        DrawRectangleRec(quitBtn, hoverQuit ? PINK : Fade(LIGHTGRAY, 0.9f));
-        DrawRectangleLinesEx(quitBtn, 2, GRAY);
-        DrawText("Quit (Click)", 760, 112, 20, BLACK);
+        if (dirty == DIRTY_NONE) {
+            PollInputEvents();
+            continue;
+        }
 
-        DrawText(TextFormat("Lives: %d / %d", MAX_TRIES - failedAttempts, MAX_TRIES), 740, 180, 22, RED);
+        // Layers render to textures, so this must happen outside BeginDrawing
+        PROFILE_SCOPE(&profiler, PROFILE_LAYERS) {
+            UpdateUiLayers(&layers, dirty, &atlas, &game, &keyboard, hover,
+                           FindStats(&stats, STATS_PLAYER, player, false));
+        }
 
-        // Guessed word
-        DrawText("Guess the word:", 430, 120, 20, DARKGRAY);
-        DrawGuessedWord(guessedWord, 480, 160);
+        BeginProfilePhase(&profiler, PROFILE_DRAW);
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
 
-        DrawHangmanFigure(failedAttempts);
+        DrawLayer(layers.panel, 0, 0);
+        DrawGuessedWord(&atlas, &game, 480, 160);
+
+        int misses = game.failedAttempts < MAX_TRIES ? game.failedAttempts : MAX_TRIES;
+        DrawLayer(layers.gallows[misses], GALLOWS_LAYER_X, GALLOWS_LAYER_Y);
 
         DrawText("On-screen keyboard", 40, 380, 18, YELLOW);
-        HandleKeyboardInput(keys, keyCount, mouse, false);  // Draw only
+        DrawLayer(layers.keyboard, KEYBOARD_MARGIN_X, KEYBOARD_START_Y);
+        DrawHoveredKey(&atlas, &keyboard);
 
-        if (isGameOver) {
+        if (game.isGameOver) {
+            // The word is drawn from the atlas, so no string is formatted while the overlay is shown
             DrawRectangle(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT, Fade(BLACK, 0.45f));
-            if (isWin) {
+            int x;
+            if (game.isWin) {
                 DrawText("CONGRATULATIONS! You Win !!", 250, 300, 40, LIME);
-                DrawText(TextFormat("Word: %s", secretWord), 320, 360, 28, LIGHTGRAY);
+                x = DrawAtlasText(&atlas, GLYPH_SIZE_30, "Word: ", 320, 360, LIGHTGRAY);
             } else {
                 DrawText("GAME OVER!", 340, 300, 40, RED);
-                DrawText(TextFormat("The word was: %s", secretWord), 310, 360, 28, LIGHTGRAY);
+                x = DrawAtlasText(&atlas, GLYPH_SIZE_30, "The word was: ", 310, 360, LIGHTGRAY);
             }
+            DrawAtlasWord(&atlas, GLYPH_SIZE_30, game.secretSymbols, game.wordLength, x, 360, LIGHTGRAY);
             DrawText("Click Restart or press ESC to quit", 220, 420, 18, GRAY);
         }
+        DrawProfilerOverlay(&atlas, &profiler, 10, 110);
+
+        // Latency runs to frame submission; EndDrawing may then block waiting for input
+        double submitTime = GetTime();
+        for (int i = 0; i < pendingCount; i++) RecordLatency(&latency, submitTime - pendingTimestamps[i]);
+        pendingCount = 0;
+        EndProfilePhase(&profiler, PROFILE_DRAW);
+
+        PROFILE_SCOPE(&profiler, PROFILE_PRESENT) EndDrawing();
+        EndProfileFrame(&profiler);
+        dirty = DIRTY_NONE;
+    }
+
+    if (profileFile) {
+        if (WriteProfile(&profiler, profileFile)) printf("Frame timings written to %s\n", profileFile);
+        else fprintf(stderr, "%s: frame timings not written\n", profileFile);
+    }
+    FreeProfiler(&profiler);
+
+    if (latency.count > 0) {
+        printf("Input-to-reveal latency: %lld guesses, avg %.3f ms, max %.3f ms\n",
+               latency.count, 1000.0 * latency.total / latency.count, 1000.0 * latency.max);
+    }
+
+    EndGameRecord(&gameLog, &game, (uint32_t)((GetTime() - roundStart) * 1000.0));
+    CloseGameLog(&gameLog);
 
-        EndDrawing();
+    StopStatsWriter(&statsWriter);
+    const StatsEntry *playerStats = FindStats(&stats, STATS_PLAYER, player, false);
+    if (playerStats && playerStats->wins + playerStats->losses > 0) {
+        uint32_t played = playerStats->wins + playerStats->losses;
+        printf("%s: %u won, %u lost, best streak %u, avg misses %.2f, avg time %.1f s\n", player,
+               playerStats->wins, playerStats->losses, playerStats->bestStreak,
+               (double)playerStats->misses / played, (double)playerStats->playMs / played / 1000.0);
     }
+    FreeStats(&stats);
 
+    UnloadSoundBank(&sounds);
+    UnloadUiLayers(&layers);
+    UnloadGlyphAtlas(&atlas);
+    StopWordWatcher(&watcher);
+    FreeWordBundle(dictionary);
     CloseWindow();
     return 0;
 }
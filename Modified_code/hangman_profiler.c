@@ -0,0 +1,214 @@
+/**
+ * @file hangman_profiler.c
+ * @brief Frame profiler: per-phase timings, p50/p99 overlay and a dump on exit
+ *
+ * Phases are timed with GetTime around each stage of the game loop; a
+ * phase entered several times in one frame accumulates. The overlay is
+ * drawn from the glyph atlas, so showing it formats no strings. Requires
+ * hangman_glyph_atlas.c in the same build.
+ */
+
+#include "hangman_types.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *profilePhaseNames[PROFILE_PHASE_COUNT] = {
+    "input", "hint", "logic", "layers", "draw", "present"
+};
+
+/**
+ * @brief Sets up an idle profiler
+ * @param recordAlways record every frame for a dump, not just while the overlay is shown
+ * @return false if the history cannot be allocated; the profiler then records nothing
+ */
+bool InitializeProfiler(FrameProfiler *profiler, bool recordAlways) {
+    memset(profiler, 0, sizeof(*profiler));
+    profiler->history = malloc(PROFILE_HISTORY_FRAMES * sizeof(FrameTiming));
+    profiler->recordAlways = recordAlways && profiler->history;
+    return profiler->history != NULL;
+}
+
+void FreeProfiler(FrameProfiler *profiler) {
+    free(profiler->history);
+    memset(profiler, 0, sizeof(*profiler));
+}
+
+/**
+ * @brief Whether frames are being recorded; the game loop then draws every frame
+ */
+bool ProfilerActive(const FrameProfiler *profiler) {
+    return profiler->history && (profiler->overlayVisible || profiler->recordAlways);
+}
+
+void ToggleProfilerOverlay(FrameProfiler *profiler) {
+    profiler->overlayVisible = !profiler->overlayVisible;
+}
+
+void BeginProfileFrame(FrameProfiler *profiler) {
+    if (!ProfilerActive(profiler)) return;
+    memset(&profiler->current, 0, sizeof(profiler->current));
+    profiler->frameStart = GetTime();
+}
+
+void BeginProfilePhase(FrameProfiler *profiler, ProfilePhase phase) {
+    if (ProfilerActive(profiler)) profiler->phaseStart[phase] = GetTime();
+}
+
+void EndProfilePhase(FrameProfiler *profiler, ProfilePhase phase) {
+    if (!ProfilerActive(profiler)) return;
+    profiler->current.phaseMs[phase] += (float)((GetTime() - profiler->phaseStart[phase]) * 1000.0);
+}
+
+static int CompareFloats(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief p50 and p99 of count samples; samples is reordered
+ */
+static void Percentiles(float *samples, uint32_t count, float *p50, float *p99) {
+    if (count == 0) {
+        *p50 = *p99 = 0.0f;
+        return;
+    }
+    qsort(samples, count, sizeof(float), CompareFloats);
+    // Nearest rank: the smallest sample with at least p% of samples at or below it
+    *p50 = samples[(count + 1) / 2 - 1];
+    *p99 = samples[(count * 99 + 99) / 100 - 1];
+}
+
+/**
+ * @brief Timing of the i-th oldest recorded frame
+ */
+static const FrameTiming *RecordedFrame(const FrameProfiler *profiler, uint32_t i) {
+    uint64_t first = profiler->frameCount - profiler->historyCount;
+    return &profiler->history[(first + i) % PROFILE_HISTORY_FRAMES];
+}
+
+/**
+ * @brief Value of metric in timing; metric PROFILE_PHASE_COUNT is the whole frame
+ */
+static float TimingMetric(const FrameTiming *timing, int metric) {
+    return metric < PROFILE_PHASE_COUNT ? timing->phaseMs[metric] : timing->frameMs;
+}
+
+/**
+ * @brief p50/p99 of every metric over the last count recorded frames
+ */
+static void SummarizeFrames(const FrameProfiler *profiler, uint32_t count, float *scratch, float *p50, float *p99) {
+    uint32_t first = profiler->historyCount - count;
+    for (int metric = 0; metric <= PROFILE_PHASE_COUNT; metric++) {
+        for (uint32_t i = 0; i < count; i++) scratch[i] = TimingMetric(RecordedFrame(profiler, first + i), metric);
+        Percentiles(scratch, count, &p50[metric], &p99[metric]);
+    }
+}
+
+/**
+ * @brief Records the frame begun by BeginProfileFrame; call right after EndDrawing
+ */
+void EndProfileFrame(FrameProfiler *profiler) {
+    if (!ProfilerActive(profiler)) return;
+
+    profiler->current.frameMs = (float)((GetTime() - profiler->frameStart) * 1000.0);
+    profiler->history[profiler->frameCount % PROFILE_HISTORY_FRAMES] = profiler->current;
+    profiler->frameCount++;
+    if (profiler->historyCount < PROFILE_HISTORY_FRAMES) profiler->historyCount++;
+
+    if (profiler->overlayVisible && profiler->frameCount % PROFILE_SUMMARY_FRAMES == 0) {
+        float scratch[PROFILE_WINDOW_FRAMES];
+        uint32_t count = profiler->historyCount < PROFILE_WINDOW_FRAMES ? profiler->historyCount
+                                                                        : PROFILE_WINDOW_FRAMES;
+        SummarizeFrames(profiler, count, scratch, profiler->p50, profiler->p99);
+    }
+}
+
+/**
+ * @brief Draws one "name  p50 N us  p99 N us" row of the overlay
+ */
+static void DrawProfileRow(const GlyphAtlas *atlas, const char *name, float p50, float p99, int x, int y) {
+    DrawAtlasText(atlas, GLYPH_SIZE_20, name, x, y, WHITE);
+    int column = DrawAtlasText(atlas, GLYPH_SIZE_20, "p50 ", x + 90, y, LIGHTGRAY);
+    column = DrawAtlasNumber(atlas, GLYPH_SIZE_20, (int)(p50 * 1000.0f), column, y, WHITE);
+    DrawAtlasText(atlas, GLYPH_SIZE_20, " us", column, y, LIGHTGRAY);
+    column = DrawAtlasText(atlas, GLYPH_SIZE_20, "p99 ", x + 230, y, LIGHTGRAY);
+    column = DrawAtlasNumber(atlas, GLYPH_SIZE_20, (int)(p99 * 1000.0f), column, y, YELLOW);
+    DrawAtlasText(atlas, GLYPH_SIZE_20, " us", column, y, LIGHTGRAY);
+}
+
+/**
+ * @brief Draws rolling p50/p99 of the frame and each phase, if the overlay is shown
+ */
+void DrawProfilerOverlay(const GlyphAtlas *atlas, const FrameProfiler *profiler, int x, int y) {
+    if (!profiler->overlayVisible) return;
+
+    const int rowHeight = 22;
+    DrawRectangle(x, y, 380, (PROFILE_PHASE_COUNT + 2) * rowHeight + 8, Fade(BLACK, 0.75f));
+    int column = DrawAtlasText(atlas, GLYPH_SIZE_20, "Profiler (F3)  last ", x + 8, y + 4, SKYBLUE);
+    DrawAtlasNumber(atlas, GLYPH_SIZE_20, PROFILE_WINDOW_FRAMES, column, y + 4, SKYBLUE);
+
+    y += 4 + rowHeight;
+    DrawProfileRow(atlas, "frame", profiler->p50[PROFILE_PHASE_COUNT], profiler->p99[PROFILE_PHASE_COUNT], x + 8, y);
+    for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) {
+        y += rowHeight;
+        DrawProfileRow(atlas, profilePhaseNames[phase], profiler->p50[phase], profiler->p99[phase], x + 8, y);
+    }
+}
+
+/**
+ * @brief Writes the recorded frames, oldest first
+ *
+ * A filename ending in ".json" gets a JSON object with p50/p99 over all
+ * recorded frames and the per-frame samples; anything else gets CSV with
+ * one row per frame. Times are in milliseconds.
+ * @return false if nothing was recorded or the file cannot be written
+ */
+bool WriteProfile(const FrameProfiler *profiler, const char *filename) {
+    uint32_t count = profiler->historyCount;
+    if (count == 0) return false;
+    FILE *file = fopen(filename, "w");
+    if (!file) return false;
+
+    size_t length = strlen(filename);
+    bool json = length >= 5 && strcmp(filename + length - 5, ".json") == 0;
+
+    if (!json) {
+        fprintf(file, "frame,frame_ms");
+        for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) fprintf(file, ",%s_ms", profilePhaseNames[phase]);
+        fprintf(file, "\n");
+        for (uint32_t i = 0; i < count; i++) {
+            const FrameTiming *timing = RecordedFrame(profiler, i);
+            fprintf(file, "%llu,%.4f", (unsigned long long)(profiler->frameCount - count + i), timing->frameMs);
+            for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) fprintf(file, ",%.4f", timing->phaseMs[phase]);
+            fprintf(file, "\n");
+        }
+        return fclose(file) == 0;
+    }
+
+    float p50[PROFILE_PHASE_COUNT + 1], p99[PROFILE_PHASE_COUNT + 1];
+    float *scratch = malloc(count * sizeof(float));
+    if (!scratch) {
+        fclose(file);
+        return false;
+    }
+    SummarizeFrames(profiler, count, scratch, p50, p99);
+    free(scratch);
+
+    fprintf(file, "{\"frames\":%u,\"summary\":{\"frame\":{\"p50\":%.4f,\"p99\":%.4f}", count,
+            p50[PROFILE_PHASE_COUNT], p99[PROFILE_PHASE_COUNT]);
+    for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) {
+        fprintf(file, ",\"%s\":{\"p50\":%.4f,\"p99\":%.4f}", profilePhaseNames[phase], p50[phase], p99[phase]);
+    }
+    fprintf(file, "},\"columns\":[\"frame\"");
+    for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) fprintf(file, ",\"%s\"", profilePhaseNames[phase]);
+    fprintf(file, "],\"samples\":[");
+    for (uint32_t i = 0; i < count; i++) {
+        const FrameTiming *timing = RecordedFrame(profiler, i);
+        fprintf(file, "%s[%.4f", i ? "," : "", timing->frameMs);
+        for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) fprintf(file, ",%.4f", timing->phaseMs[phase]);
+        fprintf(file, "]");
+    }
+    fprintf(file, "]}\n");
+    return fclose(file) == 0;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file hangman_random.c
+ * @brief Seedable PRNG for game setup and simulated players
+ *
+ * Unlike rand(), every Rng is independent state owned by its caller, so
+ * threads never share it and a given seed always replays the same game.
+ */
+
+#include "hangman_core.h"
+
+/**
+ * @brief Creates a generator; any seed (including 0) is valid
+ */
+Rng SeedRng(uint64_t seed) {
+    return (Rng){seed};
+}
+
+/**
+ * @brief Next 64 random bits (SplitMix64)
+ */
+uint64_t NextRandom(Rng *rng) {
+    uint64_t z = (rng->state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Unbiased integer in [0, bound) by Lemire's multiply-and-reject
+ */
+uint32_t RandomBelow(Rng *rng, uint32_t bound) {
+    if (bound == 0) return 0;
+
+    uint64_t product = (uint64_t)(uint32_t)NextRandom(rng) * bound;
+    uint32_t low = (uint32_t)product;
+    if (low < bound) {
+        uint32_t threshold = (uint32_t)(-bound) % bound;
+        while (low < threshold) {
+            product = (uint64_t)(uint32_t)NextRandom(rng) * bound;
+            low = (uint32_t)product;
+        }
+    }
+    return (uint32_t)(product >> 32);
+}
+
+/**
+ * @brief Mixes several values into one seed, e.g. (base seed, word, strategy, round)
+ */
+uint64_t DeriveSeed(uint64_t base, uint64_t a, uint64_t b, uint64_t c) {
+    Rng rng = SeedRng(base ^ (a * 0xD6E8FEB86659FD93ull));
+    rng.state ^= NextRandom(&rng) + b * 0xA0761D6478BD642Full;
+    rng.state ^= NextRandom(&rng) + c * 0xE7037ED1A0B428DBull;
+    return NextRandom(&rng);
+}
@@ -0,0 +1,104 @@
+/**
+ * @file hangman_replay.c
+ * @brief Replays and aggregates a binary game log
+ *
+ * Usage: hangman_replay [--words FILE] [--no-verify] [games.hgr]
+ *
+ * Every record made with the loaded word list is replayed through the
+ * game logic and checked against its recorded outcome; the totals are
+ * printed as one JSON object. With --no-verify records are only counted.
+ * POSIX only (clock_gettime).
+ */
+
+#include "hangman_alphabet.c"
+#include "hangman_word_list.c"
+#include "hangman_dictionary.c"
+#include "hangman_random.c"
+#include "hangman_word_index.c"
+#include "hangman_game_logic.c"
+#include "hangman_game_record.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double NowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv) {
+    const char *wordFile = "words.txt";
+    const char *logFile = "games.hgr";
+    bool verify = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--words") == 0 && i + 1 < argc) wordFile = argv[++i];
+        else if (strcmp(argv[i], "--no-verify") == 0) verify = false;
+        else if (argv[i][0] != '-') logFile = argv[i];
+        else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    WordList words;
+    bool isDictionary;
+    if (LoadWordFile(wordFile, &words, &isDictionary) == 0 && isDictionary) {
+        fprintf(stderr, "%s: outdated or damaged dictionary, rebuild it with hangman_dictc\n", wordFile);
+        return 1;
+    }
+    if (words.wordCount == 0) {
+        fprintf(stderr, "no words loaded\n");
+        return 1;
+    }
+
+    GameLogReader reader;
+    if (!OpenGameLogReader(&reader, logFile)) {
+        fprintf(stderr, "%s: not a game log\n", logFile);
+        FreeWordList(&words);
+        return 1;
+    }
+
+    uint32_t dictionaryId = GameLogDictionaryId(&words);
+    unsigned long long records = 0, foreign = 0, finished = 0, wins = 0, misses = 0, guesses = 0;
+    unsigned long long replayed = 0, mismatched = 0, durationMs = 0;
+
+    double start = NowSeconds();
+    const GameRecord *record;
+    const uint32_t *recordGuesses;
+    while (NextGameRecord(&reader, &record, &recordGuesses)) {
+        records++;
+        guesses += record->guessCount;
+        if (record->flags & GAME_RECORD_FINISHED) {
+            finished++;
+            wins += (record->flags & GAME_RECORD_WIN) != 0;
+            misses += record->misses;
+            durationMs += record->durationMs;
+        }
+
+        if (!verify) continue;
+        if (record->dictionaryId != dictionaryId) {
+            foreign++;
+            continue;
+        }
+        GameState game;
+        if (ReplayGameRecord(record, recordGuesses, &words, &game)) replayed++;
+        else mismatched++;
+    }
+    double seconds = NowSeconds() - start;
+    bool truncated = reader.offset != reader.size;
+
+    printf("{\"records\":%llu,\"finished\":%llu,\"win_rate\":%.4f,\"avg_misses\":%.3f,\"avg_duration_ms\":%.1f,"
+           "\"guesses\":%llu,\"replayed\":%llu,\"mismatched\":%llu,\"other_dictionary\":%llu,\"truncated\":%s,"
+           "\"records_per_sec\":%.1f}\n",
+           records, finished, finished ? (double)wins / finished : 0.0, finished ? (double)misses / finished : 0.0,
+           finished ? (double)durationMs / finished : 0.0, guesses, replayed, mismatched, foreign,
+           truncated ? "true" : "false", seconds > 0 ? records / seconds : 0.0);
+
+    CloseGameLogReader(&reader);
+    FreeWordList(&words);
+    return mismatched ? 1 : 0;
+}
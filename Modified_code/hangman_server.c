@@ -0,0 +1,570 @@
+/**
+ * @file hangman_server.c
+ * @brief Multiplayer game server: line protocol over TCP, one epoll loop per core
+ *
+ * Usage: hangman_server [--words FILE] [--port N] [--threads N] [--games N] [--seed N]
+ *
+ * Every worker thread owns a listening socket bound with SO_REUSEPORT, so
+ * the kernel spreads new connections over the workers, plus its own epoll
+ * loop and SessionPool; there are no per-connection threads. A game lives
+ * in the pool of the worker that created it, and players on other workers
+ * reach it through that pool's lock, which is uncontended unless a game is
+ * shared. A game ends when the connection that created it closes or
+ * starts another one.
+ *
+ * Requests and replies are single lines:
+ *   NEW | JOIN <game> | STATE | RESTART   -> GAME <state>
+ *   GUESS <letter>                        -> HIT|MISS|REPEATED|INVALID|OVER <state>
+ *   PING -> PONG, QUIT -> BYE, otherwise  -> ERR <reason>
+ * where <state> is "<game> <PLAYING|WON|LOST> <lives> <pattern> <guessed> <topic>":
+ * pattern shows hidden letters as '_' and spaces as '+' (the whole word
+ * once the game is over), guessed lists the guessed letters or '-'. Text is UTF-8.
+ * On SIGINT/SIGTERM the totals are printed as one JSON object.
+ * Linux only (epoll, SO_REUSEPORT).
+ */
+
+#define _GNU_SOURCE /* accept4 */
+
+#include "hangman_alphabet.c"
+#include "hangman_word_list.c"
+#include "hangman_dictionary.c"
+#include "hangman_random.c"
+#include "hangman_word_index.c"
+#include "hangman_game_logic.c"
+#include "hangman_session.c"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+
+#define SERVER_LINE_LENGTH     256
+#define SERVER_OUTPUT_SIZE     16384
+#define SERVER_REPLY_MAX       (64 + MAX_WORD_LENGTH * 12)
+#define SERVER_READS_PER_EVENT 16
+#define SERVER_EPOLL_EVENTS    256
+#define SERVER_POLL_MS         100
+
+typedef struct Server Server;
+typedef struct Connection Connection;
+
+typedef struct {
+    pthread_t thread;
+    Server *server;
+    int index;
+    int listenFd;
+    int epollFd;
+    pthread_mutex_t lock; /* guards pool: connections on other workers may play its games */
+    SessionPool pool;
+    Rng rng;
+    Connection *openConnections;
+    uint64_t connections;
+    uint64_t commands;
+    uint64_t gamesCreated;
+    uint64_t commandNs;
+    uint64_t maxCommandNs;
+} ServerWorker;
+
+struct Server {
+    const WordList *words;
+    ServerWorker *workers;
+    int workerCount;
+};
+
+/**
+ * @brief One client; input holds a partial line, output the reply bytes not sent yet
+ *
+ * Open connections are chained through prev/next so a stopping worker can close them all.
+ */
+struct Connection {
+    Connection *prev;
+    Connection *next;
+    int fd;
+    ServerWorker *worker;
+    uint32_t events;
+    bool closing;
+    bool discarding;
+    int gameWorker;
+    SessionId game;
+    SessionId ownedGame;
+    size_t inputUsed;
+    size_t outputUsed;
+    char input[SERVER_LINE_LENGTH];
+    char output[SERVER_OUTPUT_SIZE];
+};
+
+static atomic_bool stopRequested;
+
+static uint64_t NowNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Appends text to the connection's reply buffer; ProcessLines keeps SERVER_REPLY_MAX free
+ */
+static void Reply(Connection *connection, const char *text, size_t length) {
+    if (length > sizeof(connection->output) - connection->outputUsed) {
+        length = sizeof(connection->output) - connection->outputUsed;
+    }
+    memcpy(connection->output + connection->outputUsed, text, length);
+    connection->outputUsed += length;
+}
+
+static void ReplyText(Connection *connection, const char *text) {
+    Reply(connection, text, strlen(text));
+}
+
+/**
+ * @brief Writes the "<state>" part of a reply for a game; the caller holds the owning worker's lock
+ * @return bytes written
+ */
+static size_t FormatGame(char *out, size_t size, const Alphabet *alphabet, int workerIndex, SessionId id,
+                         const GameState *game) {
+    const char *status = !game->isGameOver ? "PLAYING" : game->isWin ? "WON" : "LOST";
+    int used = snprintf(out, size, "%x.%llx %s %d ", (unsigned)workerIndex, (unsigned long long)id, status,
+                        game->livesRemaining);
+    size_t length = used > 0 ? (size_t)used : 0;
+
+    for (int i = 0; i < game->wordLength && length + 5 < size; i++) {
+        if (game->isGameOver || ((game->revealedMask >> i) & 1u)) {
+            /* Fields are space-separated, so a space in the word needs a stand-in */
+            if (alphabet->codepoints[game->secretSymbols[i]] == ' ') out[length++] = '+';
+            else length += EncodeSymbols(alphabet, &game->secretSymbols[i], 1, out + length, size - length);
+        } else {
+            out[length++] = '_';
+        }
+    }
+    if (length + 1 < size) out[length++] = ' ';
+
+    if (!game->guessedMask && length + 1 < size) out[length++] = '-';
+    for (int letter = 0; letter < game->letterCount && length + 5 < size; letter++) {
+        if ((game->guessedMask >> letter) & 1u) {
+            uint8_t symbol = (uint8_t)letter;
+            length += EncodeSymbols(alphabet, &symbol, 1, out + length, size - length);
+        }
+    }
+    used = snprintf(out + length, size - length, " %s\n", game->topic);
+    return used > 0 ? length + (size_t)used : length;
+}
+
+/**
+ * @brief Replies "<verb> <state>" for the connection's current game, or ERR if it is gone
+ *
+ * letter is applied first when verb is NULL (a GUESS); its outcome becomes the verb.
+ */
+static void ReplyGame(Connection *connection, const char *verb, int letter, bool restart) {
+    static const char *guessVerbs[] = {"INVALID", "REPEATED", "OVER", "HIT", "MISS"};
+    ServerWorker *owner = &connection->worker->server->workers[connection->gameWorker];
+    char reply[SERVER_REPLY_MAX];
+
+    pthread_mutex_lock(&owner->lock);
+    const GameState *game = GetSession(&owner->pool, connection->game);
+    if (game) {
+        if (!verb) verb = guessVerbs[SessionGuess(&owner->pool, connection->game, letter)];
+        if (restart) RestartSession(&owner->pool, connection->game);
+        size_t length = (size_t)snprintf(reply, sizeof(reply), "%s ", verb);
+        length += FormatGame(reply + length, sizeof(reply) - length, &owner->pool.words->alphabet, owner->index,
+                             connection->game, game);
+        pthread_mutex_unlock(&owner->lock);
+        Reply(connection, reply, length);
+        return;
+    }
+    pthread_mutex_unlock(&owner->lock);
+    connection->game = 0;
+    ReplyText(connection, "ERR unknown game\n");
+}
+
+/**
+ * @brief Ends the game this connection created, if it still exists
+ */
+static void DropOwnedGame(Connection *connection) {
+    if (!connection->ownedGame) return;
+    ServerWorker *worker = connection->worker;
+    pthread_mutex_lock(&worker->lock);
+    DestroySession(&worker->pool, connection->ownedGame);
+    pthread_mutex_unlock(&worker->lock);
+    connection->ownedGame = 0;
+}
+
+/**
+ * @brief Parses a "<worker>.<session>" game id as printed by FormatGame
+ */
+static bool ParseGameId(const Server *server, const char *text, int *workerIndex, SessionId *id) {
+    char *end;
+    unsigned long worker = strtoul(text, &end, 16);
+    if (end == text || *end != '.' || worker >= (unsigned long)server->workerCount) return false;
+    text = end + 1;
+    unsigned long long session = strtoull(text, &end, 16);
+    if (end == text || *end != '\0' || session == 0) return false;
+    *workerIndex = (int)worker;
+    *id = (SessionId)session;
+    return true;
+}
+
+/**
+ * @brief Executes one request line (without its newline)
+ */
+static void HandleCommand(Connection *connection, char *line) {
+    ServerWorker *worker = connection->worker;
+    char *argument = strchr(line, ' ');
+    if (argument) {
+        *argument++ = '\0';
+        while (*argument == ' ') argument++;
+    } else {
+        argument = line + strlen(line);
+    }
+
+    if (strcasecmp(line, "GUESS") == 0) {
+        if (!connection->game) {
+            ReplyText(connection, "ERR no game\n");
+            return;
+        }
+        uint32_t codepoint = 0;
+        int size = DecodeCodepoint(argument, strlen(argument), &codepoint);
+        int letter = (size > 0 && argument[size] == '\0')
+                         ? AlphabetLetter(&worker->server->words->alphabet, codepoint)
+                         : NO_LETTER;
+        ReplyGame(connection, NULL, letter, false);
+    } else if (strcasecmp(line, "STATE") == 0 || strcasecmp(line, "RESTART") == 0) {
+        if (!connection->game) ReplyText(connection, "ERR no game\n");
+        else ReplyGame(connection, "GAME", NO_LETTER, strcasecmp(line, "RESTART") == 0);
+    } else if (strcasecmp(line, "NEW") == 0) {
+        DropOwnedGame(connection);
+        pthread_mutex_lock(&worker->lock);
+        SessionId id = CreateSession(&worker->pool, NextRandom(&worker->rng));
+        pthread_mutex_unlock(&worker->lock);
+        if (!id) {
+            ReplyText(connection, "ERR server full\n");
+            return;
+        }
+        worker->gamesCreated++;
+        connection->ownedGame = connection->game = id;
+        connection->gameWorker = worker->index;
+        ReplyGame(connection, "GAME", NO_LETTER, false);
+    } else if (strcasecmp(line, "JOIN") == 0) {
+        int gameWorker;
+        SessionId id;
+        if (!ParseGameId(worker->server, argument, &gameWorker, &id)) {
+            ReplyText(connection, "ERR bad game id\n");
+            return;
+        }
+        connection->gameWorker = gameWorker;
+        connection->game = id;
+        ReplyGame(connection, "GAME", NO_LETTER, false);
+    } else if (strcasecmp(line, "PING") == 0) {
+        ReplyText(connection, "PONG\n");
+    } else if (strcasecmp(line, "QUIT") == 0) {
+        ReplyText(connection, "BYE\n");
+        connection->closing = true;
+    } else if (line[0]) {
+        ReplyText(connection, "ERR unknown command\n");
+    }
+}
+
+/**
+ * @brief Executes every complete buffered line while the reply buffer has room for another reply
+ */
+static void ProcessLines(Connection *connection) {
+    ServerWorker *worker = connection->worker;
+    size_t start = 0;
+    if (connection->discarding) {
+        // The rest of an over-long line, already answered with an error
+        char *newline = memchr(connection->input, '\n', connection->inputUsed);
+        start = newline ? (size_t)(newline - connection->input) + 1 : connection->inputUsed;
+        connection->discarding = !newline;
+    }
+    while (!connection->closing && sizeof(connection->output) - connection->outputUsed >= SERVER_REPLY_MAX) {
+        char *newline = memchr(connection->input + start, '\n', connection->inputUsed - start);
+        if (!newline) break;
+
+        char *line = connection->input + start;
+        size_t length = (size_t)(newline - line);
+        start += length + 1;
+        if (length > 0 && line[length - 1] == '\r') length--;
+        line[length] = '\0';
+
+        uint64_t begin = NowNs();
+        HandleCommand(connection, line);
+        uint64_t elapsed = NowNs() - begin;
+        worker->commands++;
+        worker->commandNs += elapsed;
+        if (elapsed > worker->maxCommandNs) worker->maxCommandNs = elapsed;
+    }
+    memmove(connection->input, connection->input + start, connection->inputUsed - start);
+    connection->inputUsed -= start;
+}
+
+/**
+ * @brief Sends as much pending output as the socket takes
+ * @return false if the connection failed
+ */
+static bool FlushOutput(Connection *connection) {
+    size_t sent = 0;
+    while (sent < connection->outputUsed) {
+        ssize_t n = send(connection->fd, connection->output + sent, connection->outputUsed - sent, MSG_NOSIGNAL);
+        if (n > 0) sent += (size_t)n;
+        else if (n < 0 && errno == EINTR) continue;
+        else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        else return false;
+    }
+    memmove(connection->output, connection->output + sent, connection->outputUsed - sent);
+    connection->outputUsed -= sent;
+    return true;
+}
+
+static void CloseConnection(Connection *connection) {
+    DropOwnedGame(connection);
+    if (connection->prev) connection->prev->next = connection->next;
+    else connection->worker->openConnections = connection->next;
+    if (connection->next) connection->next->prev = connection->prev;
+    close(connection->fd);
+    free(connection);
+}
+
+/**
+ * @brief Reads, executes and answers requests until the socket would block
+ *
+ * While replies are still unsent the connection waits for EPOLLOUT and
+ * reads nothing, so a client that does not read its replies is throttled
+ * instead of growing the server's buffers.
+ */
+static void ServeConnection(Connection *connection) {
+    for (int reads = 0;; reads++) {
+        ProcessLines(connection);
+        if (!FlushOutput(connection)) {
+            CloseConnection(connection);
+            return;
+        }
+        if (connection->outputUsed > 0 || connection->closing || reads == SERVER_READS_PER_EVENT) break;
+
+        if (connection->inputUsed == sizeof(connection->input)) {
+            ReplyText(connection, "ERR line too long\n");
+            connection->inputUsed = 0;
+            connection->discarding = true;
+            continue;
+        }
+        ssize_t n = recv(connection->fd, connection->input + connection->inputUsed,
+                         sizeof(connection->input) - connection->inputUsed, 0);
+        if (n > 0) {
+            connection->inputUsed += (size_t)n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            CloseConnection(connection);
+            return;
+        }
+    }
+
+    if (connection->closing && connection->outputUsed == 0) {
+        CloseConnection(connection);
+        return;
+    }
+    uint32_t events = connection->outputUsed > 0 ? EPOLLOUT : EPOLLIN;
+    if (events != connection->events) {
+        struct epoll_event event = {events, {.ptr = connection}};
+        epoll_ctl(connection->worker->epollFd, EPOLL_CTL_MOD, connection->fd, &event);
+        connection->events = events;
+    }
+}
+
+/**
+ * @brief Accepts every pending connection on the worker's listening socket
+ */
+static void AcceptConnections(ServerWorker *worker) {
+    for (;;) {
+        int fd = accept4(worker->listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            return;
+        }
+
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        Connection *connection = malloc(sizeof(Connection));
+        if (!connection) {
+            close(fd);
+            continue;
+        }
+        memset(connection, 0, offsetof(Connection, input));
+        connection->fd = fd;
+        connection->worker = worker;
+        connection->events = EPOLLIN;
+
+        struct epoll_event event = {EPOLLIN, {.ptr = connection}};
+        if (epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            free(connection);
+            continue;
+        }
+        connection->next = worker->openConnections;
+        if (connection->next) connection->next->prev = connection;
+        worker->openConnections = connection;
+        worker->connections++;
+    }
+}
+
+static void *ServerWorkerThread(void *argument) {
+    ServerWorker *worker = argument;
+    struct epoll_event events[SERVER_EPOLL_EVENTS];
+
+    while (!atomic_load_explicit(&stopRequested, memory_order_relaxed)) {
+        int count = epoll_wait(worker->epollFd, events, SERVER_EPOLL_EVENTS, SERVER_POLL_MS);
+        for (int i = 0; i < count; i++) {
+            if (events[i].data.ptr) ServeConnection(events[i].data.ptr);
+            else AcceptConnections(worker);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Opens the worker's SO_REUSEPORT listening socket and epoll instance
+ * @return false on any socket error (errno is left set)
+ */
+static bool OpenWorkerSockets(ServerWorker *worker, int port) {
+    worker->listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    worker->epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (worker->listenFd < 0 || worker->epollFd < 0) return false;
+
+    int one = 1;
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((uint16_t)port);
+
+    struct epoll_event event = {EPOLLIN, {.ptr = NULL}};
+    return setsockopt(worker->listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) == 0 &&
+           setsockopt(worker->listenFd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) == 0 &&
+           bind(worker->listenFd, (struct sockaddr *)&address, sizeof(address)) == 0 &&
+           listen(worker->listenFd, SOMAXCONN) == 0 &&
+           epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, worker->listenFd, &event) == 0;
+}
+
+/**
+ * @brief Closes the worker's sockets and every connection still open on it
+ */
+static void CloseWorker(ServerWorker *worker) {
+    while (worker->openConnections) CloseConnection(worker->openConnections);
+    if (worker->epollFd >= 0) close(worker->epollFd);
+    if (worker->listenFd >= 0) close(worker->listenFd);
+}
+
+int main(int argc, char **argv) {
+    const char *wordFile = "words.txt";
+    int port = 7777;
+    int threadCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int gamesPerWorker = 8192;
+    uint64_t seed = (uint64_t)time(NULL);
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            fprintf(stderr, "missing value for %s\n", argv[i]);
+            return 2;
+        }
+        if (strcmp(argv[i], "--words") == 0) wordFile = argv[i + 1];
+        else if (strcmp(argv[i], "--port") == 0) port = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--threads") == 0) threadCount = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--games") == 0) gamesPerWorker = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--seed") == 0) seed = strtoull(argv[i + 1], NULL, 10);
+        else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+        i++;
+    }
+    if (threadCount < 1) threadCount = 1;
+    if (port <= 0 || port > 65535) {
+        fprintf(stderr, "bad port %d\n", port);
+        return 2;
+    }
+
+    WordList words;
+    bool isDictionary;
+    if (LoadWordFile(wordFile, &words, &isDictionary) == 0 && isDictionary) {
+        fprintf(stderr, "%s: outdated or damaged dictionary, rebuild it with hangman_dictc\n", wordFile);
+        return 1;
+    }
+    if (words.wordCount == 0) {
+        fprintf(stderr, "no words loaded\n");
+        return 1;
+    }
+
+    Server server = {&words, calloc((size_t)threadCount, sizeof(ServerWorker)), threadCount};
+    if (!server.workers) {
+        FreeWordList(&words);
+        return 1;
+    }
+
+    // Workers inherit the blocked signals; the main thread waits for them with sigwait
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    int started = 0;
+    for (; started < threadCount; started++) {
+        ServerWorker *worker = &server.workers[started];
+        worker->server = &server;
+        worker->index = started;
+        worker->listenFd = worker->epollFd = -1;
+        worker->rng = SeedRng(DeriveSeed(seed, (uint64_t)started, 0, 0));
+        pthread_mutex_init(&worker->lock, NULL);
+        if (!InitializeSessionPool(&worker->pool, gamesPerWorker, &words) || !OpenWorkerSockets(worker, port)) {
+            fprintf(stderr, "worker %d: cannot listen on port %d: %s\n", started, port, strerror(errno));
+            break;
+        }
+        if (pthread_create(&worker->thread, NULL, ServerWorkerThread, worker) != 0) break;
+    }
+    if (started == threadCount) {
+        fprintf(stderr, "hangman_server: %u words, port %d, %d workers\n", words.wordCount, port, threadCount);
+        int signalNumber;
+        sigwait(&stopSignals, &signalNumber);
+    }
+    atomic_store(&stopRequested, true);
+
+    for (int i = 0; i < started; i++) pthread_join(server.workers[i].thread, NULL);
+
+    // Workers up to the one that failed were set up; closing runs after every join, as games are shared
+    int prepared = started < threadCount ? started + 1 : threadCount;
+    for (int i = 0; i < prepared; i++) CloseWorker(&server.workers[i]);
+
+    uint64_t connections = 0, commands = 0, gamesCreated = 0, commandNs = 0, maxCommandNs = 0;
+    for (int i = 0; i < threadCount; i++) {
+        ServerWorker *worker = &server.workers[i];
+        connections += worker->connections;
+        commands += worker->commands;
+        gamesCreated += worker->gamesCreated;
+        commandNs += worker->commandNs;
+        if (worker->maxCommandNs > maxCommandNs) maxCommandNs = worker->maxCommandNs;
+    }
+    printf("{\"workers\":%d,\"connections\":%llu,\"games\":%llu,\"commands\":%llu,\"avg_command_us\":%.3f,"
+           "\"max_command_us\":%.3f}\n",
+           threadCount, (unsigned long long)connections, (unsigned long long)gamesCreated,
+           (unsigned long long)commands, commands ? commandNs / 1000.0 / commands : 0.0, maxCommandNs / 1000.0);
+
+    for (int i = 0; i < prepared; i++) {
+        FreeSessionPool(&server.workers[i].pool);
+        pthread_mutex_destroy(&server.workers[i].lock);
+    }
+    free(server.workers);
+    FreeWordList(&words);
+    return started == threadCount ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file hangman_session.c
+ * @brief Session pool: many independent games addressed by SessionId
+ *
+ * Slots live in one array and free slots are chained through nextFree,
+ * so create, guess, query and destroy are all O(1). Each session owns an
+ * Rng seeded by its creator and draws one seed per round from it, so a
+ * session replays identically and sessions never share random state.
+ * Requires the game logic from hangman_game_logic.c, hangman_random.c,
+ * hangman_word_list.c and hangman_word_index.c in the same build.
+ */
+
+#include "hangman_core.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SESSION_INDEX(id)      ((int)((id) & 0xFFFFFFFFu) - 1)
+#define SESSION_GENERATION(id) ((uint32_t)((id) >> 32))
+
+/**
+ * @brief Allocates a pool able to hold capacity live sessions
+ * @return false if the allocation fails or the arguments are unusable
+ */
+bool InitializeSessionPool(SessionPool *pool, int capacity, const WordList *words) {
+    memset(pool, 0, sizeof(*pool));
+    if (capacity <= 0 || words->wordCount == 0) return false;
+
+    pool->slots = calloc((size_t)capacity, sizeof(SessionSlot));
+    if (!pool->slots) return false;
+
+    for (int i = 0; i < capacity; i++) pool->slots[i].nextFree = i + 1;
+    pool->slots[capacity - 1].nextFree = -1;
+
+    pool->capacity = capacity;
+    pool->freeHead = 0;
+    pool->words = words;
+    return true;
+}
+
+/**
+ * @brief Releases the pool; every SessionId issued by it becomes invalid
+ */
+void FreeSessionPool(SessionPool *pool) {
+    free(pool->slots);
+    memset(pool, 0, sizeof(*pool));
+}
+
+/**
+ * @brief Resolves an id to its live slot, or NULL if it is stale or unknown
+ */
+static SessionSlot *LookupSession(const SessionPool *pool, SessionId id) {
+    int index = SESSION_INDEX(id);
+    if (index < 0 || index >= pool->capacity) return NULL;
+
+    SessionSlot *slot = &pool->slots[index];
+    if (!slot->inUse || slot->generation != SESSION_GENERATION(id)) return NULL;
+    return slot;
+}
+
+/**
+ * @brief Takes a slot off the free list and marks it live
+ * @return the slot, or NULL when the pool is full
+ */
+static SessionSlot *AcquireSlot(SessionPool *pool) {
+    if (pool->freeHead < 0) return NULL;
+
+    int index = pool->freeHead;
+    SessionSlot *slot = &pool->slots[index];
+    pool->freeHead = slot->nextFree;
+
+    slot->inUse = true;
+    slot->nextFree = -1;
+    pool->activeCount++;
+    return slot;
+}
+
+static SessionId SlotId(const SessionPool *pool, const SessionSlot *slot) {
+    return ((SessionId)slot->generation << 32) | (SessionId)(slot - pool->slots + 1);
+}
+
+/**
+ * @brief Starts a new game in a free slot
+ * @param seed seeds the session's generator; every round it plays follows from it
+ * @return id of the new session, or 0 when the pool is full
+ */
+SessionId CreateSession(SessionPool *pool, uint64_t seed) {
+    SessionSlot *slot = AcquireSlot(pool);
+    if (!slot) return 0;
+
+    slot->rng = SeedRng(seed);
+    InitializeGame(&slot->state, pool->words, NextRandom(&slot->rng));
+    return SlotId(pool, slot);
+}
+
+/**
+ * @brief Starts a new game whose word matches filter (themed rounds, difficulty)
+ * @return id of the new session, or 0 when the pool is full or nothing matches
+ */
+SessionId CreateFilteredSession(SessionPool *pool, const WordIndex *index, const WordFilter *filter, uint64_t seed) {
+    const uint32_t *slice;
+    if (FilterWords(index, filter, &slice) == 0) return 0;
+
+    SessionSlot *slot = AcquireSlot(pool);
+    if (!slot) return 0;
+
+    slot->rng = SeedRng(seed);
+    InitializeFilteredGame(&slot->state, pool->words, index, filter, NextRandom(&slot->rng));
+    return SlotId(pool, slot);
+}
+
+/**
+ * @brief Applies a guess to a session
+ */
+GuessResult SessionGuess(SessionPool *pool, SessionId id, int letter) {
+    SessionSlot *slot = LookupSession(pool, id);
+    if (!slot) return GUESS_INVALID;
+
+    return ProcessGuess(&slot->state, letter);
+}
+
+/**
+ * @brief Read-only view of a session's game state, or NULL for a bad id
+ */
+const GameState *GetSession(const SessionPool *pool, SessionId id) {
+    SessionSlot *slot = LookupSession(pool, id);
+    return slot ? &slot->state : NULL;
+}
+
+/**
+ * @brief Starts a fresh round in an existing session, keeping its id
+ */
+bool RestartSession(SessionPool *pool, SessionId id) {
+    SessionSlot *slot = LookupSession(pool, id);
+    if (!slot) return false;
+
+    InitializeGame(&slot->state, pool->words, NextRandom(&slot->rng));
+    return true;
+}
+
+/**
+ * @brief Returns a live slot to the free list; ids issued for it go stale
+ */
+static void ReleaseSlot(SessionPool *pool, SessionSlot *slot) {
+    int index = (int)(slot - pool->slots);
+    slot->inUse = false;
+    slot->generation++;
+    slot->nextFree = pool->freeHead;
+    pool->freeHead = index;
+    pool->activeCount--;
+}
+
+/**
+ * @brief Ends a session and returns its slot to the free list
+ */
+bool DestroySession(SessionPool *pool, SessionId id) {
+    SessionSlot *slot = LookupSession(pool, id);
+    if (!slot) return false;
+
+    ReleaseSlot(pool, slot);
+    return true;
+}
+
+/**
+ * @brief Packs a session's game into packed and ends the session, freeing its slot
+ */
+bool SuspendSession(SessionPool *pool, SessionId id, PackedGame *packed) {
+    SessionSlot *slot = LookupSession(pool, id);
+    if (!slot) return false;
+
+    PackGameState(&slot->state, packed);
+    ReleaseSlot(pool, slot);
+    return true;
+}
+
+/**
+ * @brief Continues a suspended game in a free slot
+ *
+ * The session generator is not part of PackedGame, so later rounds of the
+ * resumed session follow from seed instead.
+ * @return id of the new session, or 0 when the pool is full or the game does not fit the pool's word list
+ */
+SessionId ResumeSession(SessionPool *pool, const PackedGame *packed, uint64_t seed) {
+    SessionSlot *slot = AcquireSlot(pool);
+    if (!slot) return 0;
+
+    if (!RestoreGameState(&slot->state, pool->words, packed)) {
+        ReleaseSlot(pool, slot);
+        return 0;
+    }
+    slot->rng = SeedRng(seed);
+    return SlotId(pool, slot);
+}
@@ -0,0 +1,270 @@
+/**
+ * @file hangman_solver.c
+ * @brief Entropy-based hint engine over the loaded dictionary
+ *
+ * Candidates are the dictionary words of the secret word's length. Letter
+ * bitsets narrow them to words containing every revealed letter and none
+ * of the missed ones, then a per-word check against the revealed pattern
+ * leaves the exact survivors. The suggested letter is the unguessed one
+ * whose outcome (the set of positions it would reveal) splits the
+ * survivors with the highest entropy. Requires hangman_word_list.c and
+ * hangman_word_index.c in the same build.
+ */
+
+#include "hangman_core.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Most frequent unguessed letter; the fallback when no dictionary word fits
+ */
+static int FallbackLetter(const Solver *solver, const GameState *game) {
+    const Alphabet *alphabet = &solver->words->alphabet;
+    for (int i = 0; i < alphabet->letterCount; i++) {
+        int letter = alphabet->frequencyOrder[i];
+        if (!((game->guessedMask >> letter) & 1u)) return letter;
+    }
+    return NO_LETTER;
+}
+
+/**
+ * @brief Builds the per-length letter bitsets
+ * @return false on allocation failure
+ */
+bool BuildSolver(Solver *solver, const WordList *words, const WordIndex *index) {
+    memset(solver, 0, sizeof(*solver));
+    solver->words = words;
+    solver->index = index;
+    solver->letterCount = words->alphabet.letterCount;
+
+    size_t totalBlocks = 0;
+    for (int length = 1; length < MAX_WORD_LENGTH; length++) {
+        uint32_t bucketSize = index->lengthStart[length + 1] - index->lengthStart[length];
+        solver->blockOffset[length] = totalBlocks;
+        solver->blockCount[length] = (bucketSize + 63) / 64;
+        totalBlocks += (size_t)solver->blockCount[length] * solver->letterCount;
+        if (bucketSize > solver->maxBucketSize) solver->maxBucketSize = bucketSize;
+    }
+
+    solver->containsBits = calloc(totalBlocks ? totalBlocks : 1, sizeof(uint64_t));
+    if (!solver->containsBits) return false;
+
+    for (int length = 1; length < MAX_WORD_LENGTH; length++) {
+        uint32_t first = index->lengthStart[length];
+        uint32_t bucketSize = index->lengthStart[length + 1] - first;
+        uint64_t *bits = solver->containsBits + solver->blockOffset[length];
+        uint32_t blocks = solver->blockCount[length];
+
+        for (uint32_t j = 0; j < bucketSize; j++) {
+            uint64_t mask = words->entries[index->byLength[first + j]].letterMask;
+            while (mask) {
+                int letter = __builtin_ctzll(mask);
+                bits[(size_t)letter * blocks + j / 64] |= 1ull << (j % 64);
+                mask &= mask - 1;
+            }
+        }
+    }
+    return true;
+}
+
+void FreeSolver(Solver *solver) {
+    free(solver->containsBits);
+    memset(solver, 0, sizeof(*solver));
+}
+
+void FreeSolverScratch(SolverScratch *scratch) {
+    free(scratch->candidateBits);
+    free(scratch->survivors);
+    free(scratch->letterMasks);
+    free(scratch->hashKeys);
+    free(scratch->hashCounts);
+    free(scratch->hashStamps);
+    free(scratch->hashUsed);
+    memset(scratch, 0, sizeof(*scratch));
+}
+
+/**
+ * @brief Allocates scratch buffers large enough for the solver's biggest length bucket
+ */
+bool InitializeSolverScratch(SolverScratch *scratch, const Solver *solver) {
+    memset(scratch, 0, sizeof(*scratch));
+    uint32_t maxWords = solver->maxBucketSize ? solver->maxBucketSize : 1;
+
+    scratch->hashCapacity = 16;
+    while (scratch->hashCapacity < 2 * maxWords) scratch->hashCapacity *= 2;
+
+    scratch->candidateBits = malloc(((maxWords + 63) / 64) * sizeof(uint64_t));
+    scratch->survivors = malloc(maxWords * sizeof(uint32_t));
+    scratch->letterMasks = malloc((size_t)maxWords * solver->letterCount * sizeof(uint64_t));
+    scratch->hashKeys = malloc(scratch->hashCapacity * sizeof(uint64_t));
+    scratch->hashCounts = malloc(scratch->hashCapacity * sizeof(uint32_t));
+    scratch->hashStamps = calloc(scratch->hashCapacity, sizeof(uint32_t));
+    scratch->hashUsed = malloc(maxWords * sizeof(uint32_t));
+    if (!scratch->candidateBits || !scratch->survivors || !scratch->letterMasks || !scratch->hashKeys ||
+        !scratch->hashCounts || !scratch->hashStamps || !scratch->hashUsed) {
+        FreeSolverScratch(scratch);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks a word against the revealed pattern
+ *
+ * Revealed positions must match exactly; hidden positions must not hold a
+ * guessed letter, since guessing reveals every occurrence, nor a mark,
+ * since marks are shown from the start.
+ */
+static bool MatchesPattern(const uint8_t *word, const GameState *game, const uint8_t *symbolLetter) {
+    for (int i = 0; i < game->wordLength; i++) {
+        if ((game->revealedMask >> i) & 1u) {
+            if (word[i] != game->secretSymbols[i]) return false;
+        } else {
+            int letter = symbolLetter[word[i]];
+            if (letter == ALPHABET_MARK || ((game->guessedMask >> letter) & 1u)) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Collects the dictionary words consistent with the current game
+ * @return survivor count; word ids are in scratch->survivors
+ */
+uint32_t FilterCandidates(const Solver *solver, SolverScratch *scratch, const GameState *game) {
+    scratch->survivorCount = 0;
+    int length = game->wordLength;
+    if (length <= 0 || length >= MAX_WORD_LENGTH) return 0;
+
+    uint32_t first = solver->index->lengthStart[length];
+    uint32_t bucketSize = solver->index->lengthStart[length + 1] - first;
+    uint32_t blocks = solver->blockCount[length];
+    if (bucketSize == 0) return 0;
+
+    const uint8_t *symbolLetter = solver->words->alphabet.symbolLetter;
+    uint64_t required = 0;
+    for (int i = 0; i < length; i++) {
+        int letter = symbolLetter[game->secretSymbols[i]];
+        if (((game->revealedMask >> i) & 1u) && letter != ALPHABET_MARK) required |= 1ull << letter;
+    }
+    uint64_t excluded = game->guessedMask & ~required;
+
+    uint64_t *candidates = scratch->candidateBits;
+    memset(candidates, 0xFF, blocks * sizeof(uint64_t));
+    if (bucketSize % 64) candidates[blocks - 1] = (1ull << (bucketSize % 64)) - 1;
+
+    const uint64_t *bits = solver->containsBits + solver->blockOffset[length];
+    for (int letter = 0; letter < solver->letterCount; letter++) {
+        const uint64_t *letterBits = bits + (size_t)letter * blocks;
+        if ((required >> letter) & 1u) {
+            for (uint32_t b = 0; b < blocks; b++) candidates[b] &= letterBits[b];
+        } else if ((excluded >> letter) & 1u) {
+            for (uint32_t b = 0; b < blocks; b++) candidates[b] &= ~letterBits[b];
+        }
+    }
+
+    for (uint32_t b = 0; b < blocks; b++) {
+        uint64_t block = candidates[b];
+        while (block) {
+            uint32_t j = b * 64 + (uint32_t)__builtin_ctzll(block);
+            uint32_t wordId = solver->index->byLength[first + j];
+            if (MatchesPattern(WordListSymbols(solver->words, wordId), game, symbolLetter)) {
+                scratch->survivors[scratch->survivorCount++] = wordId;
+            }
+            block &= block - 1;
+        }
+    }
+    return scratch->survivorCount;
+}
+
+/**
+ * @brief Adds one outcome to the reusable hash table
+ *
+ * Slots carry the stamp of the letter being scored, so the table is never
+ * cleared between letters; hashUsed lists the slots this letter touched.
+ */
+static void CountOutcome(SolverScratch *scratch, uint64_t key) {
+    uint32_t mask = scratch->hashCapacity - 1;
+    uint32_t pos = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 40) & mask;
+    while (scratch->hashStamps[pos] == scratch->stamp && scratch->hashKeys[pos] != key) pos = (pos + 1) & mask;
+
+    if (scratch->hashStamps[pos] != scratch->stamp) {
+        scratch->hashStamps[pos] = scratch->stamp;
+        scratch->hashKeys[pos] = key;
+        scratch->hashCounts[pos] = 0;
+        scratch->hashUsed[scratch->hashUsedCount++] = pos;
+    }
+    scratch->hashCounts[pos]++;
+}
+
+static uint32_t NextStamp(SolverScratch *scratch) {
+    scratch->hashUsedCount = 0;
+    if (++scratch->stamp == 0) {
+        memset(scratch->hashStamps, 0, scratch->hashCapacity * sizeof(uint32_t));
+        scratch->stamp = 1;
+    }
+    return scratch->stamp;
+}
+
+/**
+ * @brief Suggests the unguessed letter with the highest expected information
+ * @return letter index, or NO_LETTER when every letter has been guessed
+ */
+int SuggestLetter(const Solver *solver, SolverScratch *scratch, const GameState *game) {
+    uint32_t survivorCount = FilterCandidates(solver, scratch, game);
+    if (survivorCount == 0) return FallbackLetter(solver, game);
+
+    /* Positions of each letter among the hidden cells of each survivor */
+    const uint8_t *symbolLetter = solver->words->alphabet.symbolLetter;
+    int letterCount = solver->letterCount;
+    uint64_t present = 0;
+    uint64_t hidden = ~game->revealedMask;
+    for (uint32_t s = 0; s < survivorCount; s++) {
+        uint64_t *masks = scratch->letterMasks + (size_t)s * letterCount;
+        memset(masks, 0, (size_t)letterCount * sizeof(uint64_t));
+        const uint8_t *word = WordListSymbols(solver->words, scratch->survivors[s]);
+        for (int i = 0; i < game->wordLength; i++) {
+            int letter = symbolLetter[word[i]];
+            if (letter != ALPHABET_MARK && ((hidden >> i) & 1u)) {
+                masks[letter] |= 1ull << i;
+                present |= 1ull << letter;
+            }
+        }
+    }
+
+    int best = NO_LETTER;
+    double bestScore = -1.0;
+    uint32_t bestHits = 0;
+    uint64_t open = present & ~game->guessedMask;
+    while (open) {
+        int letter = __builtin_ctzll(open);
+        open &= open - 1;
+
+        NextStamp(scratch);
+        uint32_t hits = 0;
+        for (uint32_t s = 0; s < survivorCount; s++) {
+            uint64_t outcome = scratch->letterMasks[(size_t)s * letterCount + letter];
+            CountOutcome(scratch, outcome);
+            if (outcome) hits++;
+        }
+
+        /* H = log2(n) - (1/n) * sum(c * log2(c)) over outcome classes */
+        double weighted = 0.0;
+        for (uint32_t u = 0; u < scratch->hashUsedCount; u++) {
+            double count = scratch->hashCounts[scratch->hashUsed[u]];
+            weighted += count * log2(count);
+        }
+        double entropy = log2((double)survivorCount) - weighted / survivorCount;
+
+        /* Equal information: prefer the letter more likely to be a hit */
+        if (entropy > bestScore + 1e-12 || (entropy > bestScore - 1e-12 && hits > bestHits)) {
+            bestScore = entropy;
+            bestHits = hits;
+            best = letter;
+        }
+    }
+
+    /* Every remaining candidate letter is already known: pick any unguessed letter */
+    return best != NO_LETTER ? best : FallbackLetter(solver, game);
+}
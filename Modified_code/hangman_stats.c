@@ -0,0 +1,354 @@
+/**
+ * @file hangman_stats.c
+ * @brief Persistent per-player and per-topic statistics
+ *
+ * The file is a StatsFileHeader followed by the StatsEntry array, with an
+ * FNV-1a 64 checksum over the entries. Saves write a temporary file,
+ * fsync it and rename it over the old one, so after a crash the file is
+ * either the previous or the new version, never a torn mix. The game
+ * thread only updates its in-memory table and queues the finished round;
+ * a StatsWriter thread adds queued rounds to the file under a lock file,
+ * so game processes sharing the file merge rather than overwrite, and
+ * temporary names carry the process id so their saves never collide.
+ */
+
+#include "hangman_core.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <process.h>
+#include <sys/locking.h>
+#include <sys/stat.h>
+#define fsync _commit
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#define STATS_MAGIC   "HGMSTAT"
+#define STATS_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t entryCount;
+    uint64_t checksum;
+} StatsFileHeader;
+
+static uint64_t StatsChecksum(const StatsEntry *entries, uint32_t count) {
+    const unsigned char *data = (const unsigned char *)entries;
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < (size_t)count * sizeof(StatsEntry); i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Grows table to hold at least count entries, doubling its capacity
+ * @return false if the allocation fails or the capacity would overflow
+ */
+static bool ReserveStats(StatsTable *table, uint32_t count) {
+    if (count <= table->capacity) return true;
+
+    uint32_t capacity = table->capacity ? table->capacity : 16;
+    while (capacity < count) {
+        if (capacity > UINT32_MAX / 2) return false;
+        capacity *= 2;
+    }
+    StatsEntry *entries = realloc(table->entries, (size_t)capacity * sizeof(StatsEntry));
+    if (!entries) return false;
+    table->entries = entries;
+    table->capacity = capacity;
+    return true;
+}
+
+void FreeStats(StatsTable *table) {
+    free(table->entries);
+    memset(table, 0, sizeof(*table));
+}
+
+/**
+ * @brief Reads a statistics file into table
+ *
+ * The entry count is checked against the file size before anything is
+ * allocated, so a corrupt header cannot request more than the file holds.
+ * @return false if the file is missing, foreign or corrupt (table is then empty)
+ */
+bool LoadStats(StatsTable *table, const char *filename) {
+    memset(table, 0, sizeof(*table));
+    FILE *file = fopen(filename, "rb");
+    if (!file) return false;
+
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    StatsFileHeader header;
+    bool ok = fileSize >= (long)sizeof(header) && fread(&header, sizeof(header), 1, file) == 1 &&
+              memcmp(header.magic, STATS_MAGIC, sizeof(header.magic)) == 0 &&
+              header.version == STATS_VERSION &&
+              header.entryCount <= ((size_t)fileSize - sizeof(header)) / sizeof(StatsEntry) &&
+              ReserveStats(table, header.entryCount) &&
+              fread(table->entries, sizeof(StatsEntry), header.entryCount, file) == header.entryCount &&
+              StatsChecksum(table->entries, header.entryCount) == header.checksum;
+    fclose(file);
+
+    if (!ok) {
+        FreeStats(table);
+        return false;
+    }
+    table->count = header.entryCount;
+    return true;
+}
+
+/**
+ * @brief Writes table crash-safely: temporary file, fsync, then atomic rename
+ * @return false on any I/O failure (the previous file is left untouched)
+ */
+bool SaveStats(const StatsTable *table, const char *filename) {
+    char tempName[272];
+    snprintf(tempName, sizeof(tempName), "%s.%ld.tmp", filename, (long)getpid());
+
+    StatsFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, STATS_MAGIC, sizeof(STATS_MAGIC));
+    header.version = STATS_VERSION;
+    header.entryCount = table->count;
+    header.checksum = StatsChecksum(table->entries, table->count);
+
+    FILE *file = fopen(tempName, "wb");
+    if (!file) return false;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(table->entries, sizeof(StatsEntry), table->count, file) == table->count &&
+              fflush(file) == 0 && fsync(fileno(file)) == 0;
+    ok = (fclose(file) == 0) && ok;
+
+#ifdef _WIN32
+    /* rename does not replace an existing file on Windows */
+    if (ok) remove(filename);
+#endif
+    ok = ok && rename(tempName, filename) == 0;
+    if (!ok) remove(tempName);
+    return ok;
+}
+
+/**
+ * @brief Entry for (kind, name), appended if create is set and it does not exist yet
+ * @return the entry, or NULL if it is missing (or cannot be allocated)
+ */
+StatsEntry *FindStats(StatsTable *table, StatsKind kind, const char *name, bool create) {
+    char key[STATS_NAME_LENGTH - 1] = {0};
+    strncpy(key, name, sizeof(key) - 1);
+
+    for (uint32_t i = 0; i < table->count; i++) {
+        StatsEntry *entry = &table->entries[i];
+        if (entry->kind == kind && strncmp(entry->name, key, sizeof(key)) == 0) return entry;
+    }
+    if (!create || !ReserveStats(table, table->count + 1)) return NULL;
+
+    StatsEntry *entry = &table->entries[table->count++];
+    memset(entry, 0, sizeof(*entry));
+    entry->kind = (uint8_t)kind;
+    memcpy(entry->name, key, sizeof(key));
+    return entry;
+}
+
+static void AddGameToStats(StatsEntry *entry, const StatsGame *game) {
+    if (game->isWin) {
+        entry->wins++;
+        entry->currentStreak++;
+        if (entry->currentStreak > entry->bestStreak) entry->bestStreak = entry->currentStreak;
+    } else {
+        entry->losses++;
+        entry->currentStreak = 0;
+    }
+    entry->misses += game->failedAttempts;
+    entry->playMs += game->durationMs;
+}
+
+static void ApplyStatsGame(StatsTable *table, const StatsGame *game) {
+    StatsEntry *entry = FindStats(table, STATS_PLAYER, game->player, true);
+    if (entry) AddGameToStats(entry, game);
+    entry = FindStats(table, STATS_TOPIC, game->topic, true);
+    if (entry) AddGameToStats(entry, game);
+}
+
+/**
+ * @brief Reduces a finished round to what the statistics keep
+ */
+static void MakeStatsGame(StatsGame *out, const char *player, const GameState *game, uint32_t durationMs) {
+    memset(out, 0, sizeof(*out));
+    strncpy(out->player, player, sizeof(out->player) - 1);
+    memcpy(out->topic, game->topic, strnlen(game->topic, sizeof(out->topic) - 1));
+    out->durationMs = durationMs;
+    out->failedAttempts = (uint8_t)game->failedAttempts;
+    out->isWin = game->isWin;
+}
+
+/**
+ * @brief Adds a finished round to the player's and the topic's totals
+ */
+void RecordGameStats(StatsTable *table, const char *player, const GameState *game, uint32_t durationMs) {
+    if (!game->isGameOver) return;
+
+    StatsGame round;
+    MakeStatsGame(&round, player, game, durationMs);
+    ApplyStatsGame(table, &round);
+}
+
+/**
+ * @brief Holds an exclusive lock on "<filename>.lock" until UnlockStatsFile
+ * @return lock handle, or -1 if it cannot be taken
+ */
+static int LockStatsFile(const char *filename) {
+    char lockName[272];
+    snprintf(lockName, sizeof(lockName), "%s.lock", filename);
+#ifdef _WIN32
+    int fd = _open(lockName, _O_CREAT | _O_RDWR, _S_IREAD | _S_IWRITE);
+    if (fd >= 0 && _locking(fd, _LK_LOCK, 1) != 0) {
+        _close(fd);
+        fd = -1;
+    }
+#else
+    int fd = open(lockName, O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+    if (fd >= 0 && flock(fd, LOCK_EX) != 0) {
+        close(fd);
+        fd = -1;
+    }
+#endif
+    return fd;
+}
+
+static void UnlockStatsFile(int fd) {
+#ifdef _WIN32
+    _locking(fd, _LK_UNLCK, 1);
+    _close(fd);
+#else
+    close(fd);
+#endif
+}
+
+/**
+ * @brief Adds rounds to the statistics file, keeping what other game processes saved
+ *
+ * The file is re-read, updated and saved under an exclusive lock, so
+ * instances sharing it (several kiosks on one machine) never overwrite
+ * each other's rounds.
+ * @return false if the lock or the save failed (the file is unchanged)
+ */
+bool MergeStatsGames(const char *filename, const StatsGame *games, uint32_t count) {
+    int lock = LockStatsFile(filename);
+    if (lock < 0) return false;
+
+    StatsTable table;
+    LoadStats(&table, filename);
+    for (uint32_t i = 0; i < count; i++) ApplyStatsGame(&table, &games[i]);
+    bool ok = SaveStats(&table, filename);
+    FreeStats(&table);
+
+    UnlockStatsFile(lock);
+    return ok;
+}
+
+static bool AppendStatsGames(StatsGameQueue *queue, const StatsGame *games, uint32_t count) {
+    if (count > UINT32_MAX / 2 - queue->count) return false;
+    if (queue->count + count > queue->capacity) {
+        uint32_t capacity = queue->capacity ? queue->capacity : 16;
+        while (capacity < queue->count + count) capacity *= 2;
+        StatsGame *grown = realloc(queue->games, (size_t)capacity * sizeof(StatsGame));
+        if (!grown) return false;
+        queue->games = grown;
+        queue->capacity = capacity;
+    }
+    memcpy(queue->games + queue->count, games, (size_t)count * sizeof(StatsGame));
+    queue->count += count;
+    return true;
+}
+
+static void *StatsWriterThread(void *argument) {
+    StatsWriter *writer = argument;
+    StatsGameQueue writing = {NULL, 0, 0};
+
+    pthread_mutex_lock(&writer->lock);
+    for (;;) {
+        while (!writer->pending.count && !writer->stopping) pthread_cond_wait(&writer->wake, &writer->lock);
+        bool stopping = writer->stopping;
+
+        /* Swap queues so the game thread can keep queueing; rounds a failed save left are retried with the new ones */
+        if (!writing.count) {
+            StatsGameQueue queued = writer->pending;
+            writer->pending = writing;
+            writing = queued;
+        } else if (AppendStatsGames(&writing, writer->pending.games, writer->pending.count)) {
+            writer->pending.count = 0;
+        }
+
+        pthread_mutex_unlock(&writer->lock);
+        if (writing.count && MergeStatsGames(writer->filename, writing.games, writing.count)) writing.count = 0;
+        pthread_mutex_lock(&writer->lock);
+        if (stopping) break;
+    }
+    pthread_mutex_unlock(&writer->lock);
+
+    free(writing.games);
+    return NULL;
+}
+
+/**
+ * @brief Starts the background thread that adds queued rounds to filename
+ * @return false if the thread cannot start; QueueGameStats then saves synchronously
+ */
+bool StartStatsWriter(StatsWriter *writer, const char *filename) {
+    memset(writer, 0, sizeof(*writer));
+    strncpy(writer->filename, filename, sizeof(writer->filename) - 1);
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->wake, NULL);
+    writer->running = pthread_create(&writer->thread, NULL, StatsWriterThread, writer) == 0;
+    return writer->running;
+}
+
+/**
+ * @brief Queues a finished round for the statistics file; never waits for disk I/O
+ *
+ * Rounds rather than table snapshots are queued, so the file can be
+ * merged with other processes' saves instead of overwritten.
+ */
+void QueueGameStats(StatsWriter *writer, const char *player, const GameState *game, uint32_t durationMs) {
+    if (!game->isGameOver) return;
+
+    StatsGame round;
+    MakeStatsGame(&round, player, game, durationMs);
+    if (!writer->running) {
+        MergeStatsGames(writer->filename, &round, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&writer->lock);
+    if (AppendStatsGames(&writer->pending, &round, 1)) pthread_cond_signal(&writer->wake);
+    pthread_mutex_unlock(&writer->lock);
+}
+
+/**
+ * @brief Saves any rounds still queued, then stops the thread
+ */
+void StopStatsWriter(StatsWriter *writer) {
+    if (writer->running) {
+        pthread_mutex_lock(&writer->lock);
+        writer->stopping = true;
+        pthread_cond_signal(&writer->wake);
+        pthread_mutex_unlock(&writer->lock);
+        pthread_join(writer->thread, NULL);
+    }
+    pthread_mutex_destroy(&writer->lock);
+    pthread_cond_destroy(&writer->wake);
+    free(writer->pending.games);
+    writer->running = false;
+}
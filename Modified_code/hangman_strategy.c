@@ -0,0 +1,82 @@
+/**
+ * @file hangman_strategy.c
+ * @brief Guessing strategies for headless play (benchmarks, bots, evaluation)
+ *
+ * Every strategy takes a StrategyContext; the random one draws from its
+ * Rng. Requires hangman_game_logic.c, hangman_random.c,
+ * hangman_game_record.c and hangman_solver.c in the same build.
+ */
+
+#include "hangman_core.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Uniformly random unguessed letter
+ */
+int GuessRandomLetter(const GameState *game, void *context) {
+    StrategyContext *strategyContext = context;
+    uint64_t letters = (game->letterCount >= 64) ? ~0ull : (1ull << game->letterCount) - 1;
+    uint64_t candidates = letters & ~game->guessedMask;
+    if (!candidates) return NO_LETTER;
+    return NthSetBit(candidates, RandomBelow(&strategyContext->rng, (uint32_t)__builtin_popcountll(candidates)));
+}
+
+/**
+ * @brief Most frequent letter of the alphabet not guessed yet
+ */
+int GuessByFrequency(const GameState *game, void *context) {
+    const Alphabet *alphabet = ((StrategyContext *)context)->alphabet;
+    for (int i = 0; i < alphabet->letterCount; i++) {
+        int letter = alphabet->frequencyOrder[i];
+        if (!((game->guessedMask >> letter) & 1u)) return letter;
+    }
+    return NO_LETTER;
+}
+
+/**
+ * @brief Entropy-maximizing letter from the dictionary solver
+ * @param context StrategyContext with its own scratch buffers
+ */
+int GuessWithSolver(const GameState *game, void *context) {
+    StrategyContext *strategyContext = context;
+    return SuggestLetter(strategyContext->solver, &strategyContext->scratch, game);
+}
+
+static const GuessStrategy strategies[] = {
+    {"random", GuessRandomLetter},
+    {"frequency", GuessByFrequency},
+    {"solver", GuessWithSolver},
+};
+
+#define STRATEGY_COUNT ((int)(sizeof(strategies) / sizeof(strategies[0])))
+
+/**
+ * @brief Looks up a strategy by name
+ * @return the strategy, or NULL if unknown
+ */
+const GuessStrategy *FindStrategy(const char *name) {
+    for (int i = 0; i < STRATEGY_COUNT; i++) {
+        if (strcmp(strategies[i].name, name) == 0) return &strategies[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Plays a started game to the end
+ * @param log if not NULL, receives every guess of a round begun with BeginGameRecord
+ * @return number of guesses made
+ */
+int PlayGame(GameState *game, const GuessStrategy *strategy, void *context, GameLog *log) {
+    int guesses = 0;
+    while (!game->isGameOver) {
+        int letter = strategy->guess(game, context);
+        if (letter == NO_LETTER) break;
+
+        GuessResult result = ProcessGuess(game, letter);
+        if (result != GUESS_HIT && result != GUESS_MISS) break;
+        if (log) RecordGuess(log, letter, result, 0);
+        guesses++;
+    }
+    return guesses;
+}
@@ -0,0 +1,265 @@
+/**
+ * @file hangman_types.h
+ * @brief Type definitions and constants for Hangman game
+ *
+ * Follows modular coding standards from program_style.pdf
+ *
+ * @author Aranya
+ * @date February 2026
+ */
+
+#ifndef HANGMAN_TYPES_H
+#define HANGMAN_TYPES_H
+
+#include "raylib.h"
+#include "hangman_core.h"
+#include <stdbool.h>
+
+#define WINDOW_WIDTH        1000
+#define WINDOW_HEIGHT       700
+#define KEYBOARD_KEY_WIDTH  48
+#define KEYBOARD_KEY_HEIGHT 48
+#define KEYBOARD_GAP        12
+#define KEYBOARD_MARGIN_X   40
+#define KEYBOARD_START_Y    420
+
+#define PANEL_LAYER_HEIGHT    270
+#define GALLOWS_LAYER_X       120
+#define GALLOWS_LAYER_Y       120
+#define GALLOWS_LAYER_WIDTH   310
+#define GALLOWS_LAYER_HEIGHT  390
+#define KEYBOARD_LAYER_WIDTH  (WINDOW_WIDTH - 2 * KEYBOARD_MARGIN_X)
+#define KEYBOARD_LAYER_HEIGHT (WINDOW_HEIGHT - KEYBOARD_START_Y)
+
+#define RESTART_BUTTON_RECT   ((Rectangle){720, 40, 220, 42})
+#define QUIT_BUTTON_RECT      ((Rectangle){720, 100, 220, 42})
+#define HINT_BUTTON_RECT      ((Rectangle){720, 215, 220, 42})
+
+typedef struct {
+    Rectangle rectangle;
+    int letter;
+    bool isPressed;
+    bool isVisible;
+} KeyboardKey;
+
+/**
+ * @brief On-screen keyboard; keyForLetter maps a letter index to its key
+ *
+ * Keys sit on a regular grid, so rowStart/rowLength/rowX and the pitch
+ * are enough to map a mouse position to a key index arithmetically. The
+ * rows come from the alphabet; keys shrink when they would not fit the
+ * keyboard layer at full size.
+ */
+typedef struct {
+    KeyboardKey keys[MAX_ALPHABET_LETTERS];
+    int keyCount;
+    int keyForLetter[MAX_ALPHABET_LETTERS];
+    int rowCount;
+    int rowStart[MAX_KEYBOARD_ROWS];
+    int rowLength[MAX_KEYBOARD_ROWS];
+    float rowX[MAX_KEYBOARD_ROWS];
+    float keyWidth;
+    float keyHeight;
+    float pitchX;
+    float pitchY;
+    int hoveredKey;
+} Keyboard;
+
+#define INPUT_QUEUE_CAPACITY 64
+
+typedef enum {
+    INPUT_SOURCE_KEYBOARD,
+    INPUT_SOURCE_MOUSE,
+    INPUT_SOURCE_HINT
+} InputSource;
+
+/**
+ * @brief One letter guess with the time it was collected (GetTime seconds)
+ */
+typedef struct {
+    int letter;
+    InputSource source;
+    double timestamp;
+} InputEvent;
+
+/**
+ * @brief FIFO of guesses collected this frame, in arrival order
+ *
+ * Capacity exceeds raylib's per-frame character queue plus one mouse
+ * click, and the queue is drained every frame, so it cannot overflow.
+ */
+typedef struct {
+    InputEvent events[INPUT_QUEUE_CAPACITY];
+    int head;
+    int count;
+} InputQueue;
+
+/**
+ * @brief Input-to-reveal latency totals, in seconds
+ */
+typedef struct {
+    long long count;
+    double total;
+    double max;
+} LatencyStats;
+
+/**
+ * @brief Screen regions that need redrawing; a frame with no flags set is skipped
+ */
+typedef enum {
+    DIRTY_NONE     = 0,
+    DIRTY_HEADER   = 1 << 0,
+    DIRTY_PANEL    = 1 << 1,
+    DIRTY_WORD     = 1 << 2,
+    DIRTY_FIGURE   = 1 << 3,
+    DIRTY_KEYBOARD = 1 << 4,
+    DIRTY_OVERLAY  = 1 << 5,
+    DIRTY_HOVER    = 1 << 6,
+    DIRTY_PROFILER = 1 << 7,
+    DIRTY_ALL      = (1 << 8) - 1
+} DirtyFlags;
+
+/**
+ * @brief What the mouse was over last frame; a change means a redraw
+ */
+typedef struct {
+    int hoveredKey;
+    bool hoverRestart;
+    bool hoverQuit;
+    bool hoverHint;
+} HoverState;
+
+#define GLYPH_FIRST         32
+#define GLYPH_LAST          126
+#define GLYPH_COUNT         (GLYPH_LAST - GLYPH_FIRST + 1)
+#define GLYPH_ATLAS_WIDTH   1024
+#define GLYPH_ATLAS_HEIGHT  1024
+
+/**
+ * @brief Font sizes pre-rasterized into the glyph atlas
+ */
+typedef enum {
+    GLYPH_SIZE_20,
+    GLYPH_SIZE_22,
+    GLYPH_SIZE_30,
+    GLYPH_SIZE_COUNT
+} GlyphSize;
+
+/**
+ * @brief Printable ASCII rasterized once in white at each GlyphSize;
+ * text is drawn as tinted quads from this single texture so raylib can
+ * batch a whole string, keyboard or word grid into one draw call
+ *
+ * The word list's alphabet is rasterized alongside: every symbol at each
+ * size, and the keyboard labels (uppercase where the script has case) at
+ * GLYPH_SIZE_22, using the alphabet's font when it is installed.
+ */
+typedef struct {
+    RenderTexture2D texture;
+    Rectangle glyphs[GLYPH_SIZE_COUNT][GLYPH_COUNT];
+    Rectangle symbolGlyphs[GLYPH_SIZE_COUNT][MAX_ALPHABET_SYMBOLS];
+    Rectangle keyGlyphs[MAX_ALPHABET_LETTERS];
+    int fontSizes[GLYPH_SIZE_COUNT];
+    Font letterFont;
+    bool ownsLetterFont;
+} GlyphAtlas;
+
+/**
+ * @brief Cached static screen layers, re-rendered only when their inputs change
+ *
+ * panel holds the header and controls (topic, lives, button hover),
+ * gallows[n] the figure after n misses, keyboard the keys without hover.
+ */
+typedef struct {
+    RenderTexture2D panel;
+    RenderTexture2D gallows[MAX_TRIES + 1];
+    RenderTexture2D keyboard;
+} UiLayers;
+
+#define SOUND_VOICES        4
+#define SOUND_SAMPLE_RATE   44100
+
+/**
+ * @brief Sound effects, one per guess outcome that changes the game
+ */
+typedef enum {
+    SOUND_HIT,
+    SOUND_MISS,
+    SOUND_WIN,
+    SOUND_LOSE,
+    SOUND_EFFECT_COUNT
+} SoundEffect;
+
+/**
+ * @brief Every effect decoded once at startup, with SOUND_VOICES aliases of each
+ *
+ * Aliases share their source's samples but play independently, so an
+ * effect can overlap itself without loading anything during play; voices
+ * are handed out round-robin and the oldest is restarted when all play.
+ */
+typedef struct {
+    Sound sources[SOUND_EFFECT_COUNT];
+    Sound voices[SOUND_EFFECT_COUNT][SOUND_VOICES];
+    int nextVoice[SOUND_EFFECT_COUNT];
+    bool loaded[SOUND_EFFECT_COUNT];
+    bool ownsDevice;
+} SoundBank;
+
+#define PROFILE_HISTORY_FRAMES  36000
+#define PROFILE_WINDOW_FRAMES   240
+#define PROFILE_SUMMARY_FRAMES  30
+
+/**
+ * @brief Timed phases of one frame of the game loop
+ */
+typedef enum {
+    PROFILE_INPUT,
+    PROFILE_HINT,
+    PROFILE_LOGIC,
+    PROFILE_LAYERS,
+    PROFILE_DRAW,
+    PROFILE_PRESENT,
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+/**
+ * @brief Milliseconds spent in each phase of one drawn frame and in the whole frame
+ */
+typedef struct {
+    float phaseMs[PROFILE_PHASE_COUNT];
+    float frameMs;
+} FrameTiming;
+
+/**
+ * @brief Per-frame phase timings of the game loop
+ *
+ * Only drawn frames are recorded, and only while the profiler is active,
+ * i.e. while the overlay is shown or a dump file was requested. history
+ * is a ring of the last PROFILE_HISTORY_FRAMES frames; the overlay's
+ * p50/p99 cover the last PROFILE_WINDOW_FRAMES of them and are refreshed
+ * every PROFILE_SUMMARY_FRAMES frames.
+ */
+typedef struct {
+    FrameTiming *history;
+    uint32_t historyCount;
+    uint64_t frameCount;
+    FrameTiming current;
+    double frameStart;
+    double phaseStart[PROFILE_PHASE_COUNT];
+    float p50[PROFILE_PHASE_COUNT + 1];
+    float p99[PROFILE_PHASE_COUNT + 1];
+    bool overlayVisible;
+    bool recordAlways;
+} FrameProfiler;
+
+/**
+ * @brief Times the statement or block that follows as one run of phase
+ *
+ * Leaving the block with break, continue or return skips the end of the
+ * timing, so keep such jumps out of profiled blocks.
+ */
+#define PROFILE_SCOPE(profiler, phase)                                                    \
+    for (int profileOnce_ = (BeginProfilePhase((profiler), (phase)), 1); profileOnce_; \
+         profileOnce_ = 0, EndProfilePhase((profiler), (phase)))
+
+#endif // HANGMAN_TYPES_H
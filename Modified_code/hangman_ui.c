@@ -29,64 +29,277 @@ void DrawHangmanFigure(int failedAttempts) {
 }
 
 /**
- * @brief Initializes on-screen keyboard
+ * @brief Lays out the on-screen keyboard from the alphabet's rows and builds its letter-to-key map
+ *
+ * Keys keep their full size when the rows fit the keyboard layer and
+ * shrink uniformly otherwise; shorter rows are centered under the longest.
  */
-int InitializeKeyboard(KeyboardKey *keys) {
-    const char *rows[] = {"ABCDEFGHI", "JKLMNOPQR", "STUVWXYZ"};
+int InitializeKeyboard(Keyboard *keyboard, const Alphabet *alphabet) {
+    KeyboardKey *keys = keyboard->keys;
+    int longestRow = 1;
+    for (int r = 0; r < alphabet->keyboardRowCount; r++) {
+        if (alphabet->keyboardRowLength[r] > longestRow) longestRow = alphabet->keyboardRowLength[r];
+    }
+    int rowCount = alphabet->keyboardRowCount > 0 ? alphabet->keyboardRowCount : 1;
+
+    float pitch = (float)(KEYBOARD_KEY_WIDTH + KEYBOARD_GAP);
+    if (pitch * longestRow > KEYBOARD_LAYER_WIDTH) pitch = (float)KEYBOARD_LAYER_WIDTH / longestRow;
+    if (pitch * rowCount > KEYBOARD_LAYER_HEIGHT) pitch = (float)KEYBOARD_LAYER_HEIGHT / rowCount;
+    keyboard->pitchX = keyboard->pitchY = pitch;
+    keyboard->keyWidth = pitch * KEYBOARD_KEY_WIDTH / (KEYBOARD_KEY_WIDTH + KEYBOARD_GAP);
+    keyboard->keyHeight = pitch * KEYBOARD_KEY_HEIGHT / (KEYBOARD_KEY_HEIGHT + KEYBOARD_GAP);
+
+    for (int li = 0; li < MAX_ALPHABET_LETTERS; li++) keyboard->keyForLetter[li] = -1;
     int index = 0;
-    int x, y = KEYBOARD_START_Y;
-
-    for (int r = 0; r < 3; r++) {
-        x = KEYBOARD_MARGIN_X;
-        if (r == 2) x += 24;
-        for (int i = 0; rows[r][i]; i++) {
-            keys[index].rectangle = (Rectangle){(float)x, (float)y, (float)KEYBOARD_KEY_WIDTH, (float)KEYBOARD_KEY_HEIGHT};
-            keys[index].letter = rows[r][i];
+    float y = KEYBOARD_START_Y;
+    for (int r = 0; r < alphabet->keyboardRowCount; r++) {
+        int length = alphabet->keyboardRowLength[r];
+        float x = KEYBOARD_MARGIN_X + (longestRow - length) * pitch / 2;
+        keyboard->rowStart[r] = index;
+        keyboard->rowLength[r] = length;
+        keyboard->rowX[r] = x;
+        for (int i = 0; i < length; i++) {
+            int letter = alphabet->keyboardLetters[index];
+            keys[index].rectangle = (Rectangle){x, y, keyboard->keyWidth, keyboard->keyHeight};
+            keys[index].letter = letter;
             keys[index].isPressed = false;
             keys[index].isVisible = true;
-            x += KEYBOARD_KEY_WIDTH + KEYBOARD_GAP;
+            keyboard->keyForLetter[letter] = index;
+            x += pitch;
             index++;
         }
-        y += KEYBOARD_KEY_HEIGHT + KEYBOARD_GAP;
+        y += pitch;
     }
+    keyboard->rowCount = alphabet->keyboardRowCount;
+    keyboard->keyCount = index;
+    keyboard->hoveredKey = -1;
     return index;
 }
 
 /**
- * @brief Handles keyboard drawing and mouse input
- * @return pressed letter or 0
+ * @brief Marks the key for a guessed letter as used
  */
-char HandleKeyboardInput(KeyboardKey *keys, int keyCount, Vector2 mousePos, bool clicked) {
-    char pressed = 0;
-    for (int i = 0; i < keyCount; i++) {
-        if (!keys[i].isVisible) continue;
-        Color bg = keys[i].isPressed ? Fade(DARKGREEN, 0.9f) : LIGHTGRAY;
-        if (CheckCollisionPointRec(mousePos, keys[i].rectangle)) {
-            bg = Fade(SKYBLUE, keys[i].isPressed ? 0.9f : 0.6f);
-            if (clicked && !keys[i].isPressed) {
-                keys[i].isPressed = true;
-                pressed = tolower(keys[i].letter);
-            }
-        }
-        DrawRectangleRec(keys[i].rectangle, bg);
-        DrawRectangleLinesEx(keys[i].rectangle, 2, Fade(GRAY, 0.7f));
-        DrawText(TextFormat("%c", keys[i].letter), (int)(keys[i].rectangle.x + 15), (int)(keys[i].rectangle.y + 8), 22, BLACK);
+void MarkKeyPressed(Keyboard *keyboard, int letter) {
+    if (letter >= 0 && letter < MAX_ALPHABET_LETTERS && keyboard->keyForLetter[letter] >= 0) {
+        keyboard->keys[keyboard->keyForLetter[letter]].isPressed = true;
+    }
+}
+
+/**
+ * @brief Clears the used state of every key for a new round
+ */
+void ResetKeyboard(Keyboard *keyboard) {
+    for (int i = 0; i < keyboard->keyCount; i++) keyboard->keys[i].isPressed = false;
+}
+
+/**
+ * @brief Index of the visible key under the mouse, or -1
+ *
+ * O(1): row and column come from dividing by the key pitch; a point in
+ * the gap between keys hits nothing, as with CheckCollisionPointRec.
+ */
+int KeyboardHitTest(const Keyboard *keyboard, Vector2 mousePos) {
+    const float pitchX = keyboard->pitchX;
+    const float pitchY = keyboard->pitchY;
+
+    float dy = mousePos.y - KEYBOARD_START_Y;
+    if (dy < 0) return -1;
+    int row = (int)(dy / pitchY);
+    if (row >= keyboard->rowCount || dy - row * pitchY >= keyboard->keyHeight) return -1;
+
+    float dx = mousePos.x - keyboard->rowX[row];
+    if (dx < 0) return -1;
+    int column = (int)(dx / pitchX);
+    if (column >= keyboard->rowLength[row] || dx - column * pitchX >= keyboard->keyWidth) return -1;
+
+    int index = keyboard->rowStart[row] + column;
+    return keyboard->keys[index].isVisible ? index : -1;
+}
+
+/**
+ * @brief Updates hover and handles a click in a single hit test
+ * @return letter index of a newly pressed key, or NO_LETTER
+ */
+int UpdateKeyboard(Keyboard *keyboard, Vector2 mousePos, bool clicked) {
+    int index = KeyboardHitTest(keyboard, mousePos);
+    keyboard->hoveredKey = index;
+    if (!clicked || index < 0 || keyboard->keys[index].isPressed) return NO_LETTER;
+
+    keyboard->keys[index].isPressed = true;
+    return keyboard->keys[index].letter;
+}
+
+/**
+ * @brief Draws the background and outline of one key in its used/hover colors
+ */
+static void DrawKeyFrame(const KeyboardKey *key, bool hovered) {
+    Color bg = key->isPressed ? Fade(DARKGREEN, 0.9f) : LIGHTGRAY;
+    if (hovered) bg = Fade(SKYBLUE, key->isPressed ? 0.9f : 0.6f);
+
+    DrawRectangleRec(key->rectangle, bg);
+    DrawRectangleLinesEx(key->rectangle, 2, Fade(GRAY, 0.7f));
+}
+
+static void DrawKeyLabel(const GlyphAtlas *atlas, const KeyboardKey *key) {
+    Rectangle glyph = atlas->keyGlyphs[key->letter];
+    int x = (int)(key->rectangle.x + (key->rectangle.width - glyph.width) / 2);
+    int y = (int)(key->rectangle.y + (key->rectangle.height - atlas->fontSizes[GLYPH_SIZE_22]) / 2);
+    DrawAtlasGlyph(atlas, glyph, x, y, BLACK);
+}
+
+/**
+ * @brief Draws every visible key without hover
+ *
+ * All frames go first and all labels second, so the labels form one run
+ * of atlas quads that raylib submits as a single batch.
+ */
+void DrawKeyboard(const GlyphAtlas *atlas, const Keyboard *keyboard) {
+    for (int i = 0; i < keyboard->keyCount; i++) {
+        if (keyboard->keys[i].isVisible) DrawKeyFrame(&keyboard->keys[i], false);
     }
-    return pressed;
+    for (int i = 0; i < keyboard->keyCount; i++) {
+        if (keyboard->keys[i].isVisible) DrawKeyLabel(atlas, &keyboard->keys[i]);
+    }
+}
+
+/**
+ * @brief Draws the hovered key over the cached keyboard layer
+ */
+void DrawHoveredKey(const GlyphAtlas *atlas, const Keyboard *keyboard) {
+    int hoveredKey = keyboard->hoveredKey;
+    if (hoveredKey < 0) return;
+
+    // Clear the cached key first so the translucent hover color blends as it did over the background
+    DrawRectangleRec(keyboard->keys[hoveredKey].rectangle, RAYWHITE);
+    DrawKeyFrame(&keyboard->keys[hoveredKey], true);
+    DrawKeyLabel(atlas, &keyboard->keys[hoveredKey]);
 }
 
 /**
- * @brief Draws the guessed word grid
+ * @brief Draws the guessed word grid: all cell outlines, then all letters in one batch
  */
-void DrawGuessedWord(const char *guessedWord, int startX, int py) {
+void DrawGuessedWord(const GlyphAtlas *atlas, const GameState *game, int startX, int py) {
     int spacing = 40;
-    int len = strlen(guessedWord);
-    for (int i = 0; i < len; i++) {
+    for (int i = 0; i < game->wordLength; i++) {
         Rectangle cell = {(float)(startX + i * spacing), (float)py, 36, 48};
         DrawRectangleLinesEx(cell, 2, Fade(GRAY, 0.6f));
-        if (guessedWord[i] != '_') {
-            char s[2] = {guessedWord[i], '\0'};
-            DrawText(s, (int)(cell.x + 6), (int)(cell.y + 6), 30, MAROON);
+    }
+    for (int i = 0; i < game->wordLength; i++) {
+        if ((game->revealedMask >> i) & 1u) {
+            DrawSymbol(atlas, GLYPH_SIZE_30, game->secretSymbols[i], startX + i * spacing + 6, py + 6, MAROON);
         }
     }
 }
+
+/**
+ * @brief Draws header, topic, player record, controls panel and lives
+ * @param playerStats lifetime totals of the current player, or NULL to omit the line
+ */
+void DrawControlsPanel(const GlyphAtlas *atlas, const GameState *game, HoverState hover,
+                       const StatsEntry *playerStats) {
+    DrawRectangle(0, 0, WINDOW_WIDTH, 100, Fade(LIGHTGRAY, 0.08f));
+    DrawText("HANGMAN", 350, 14, 52, DARKBLUE);
+    int x = DrawAtlasText(atlas, GLYPH_SIZE_20, "Topic: ", 30, 52, DARKGRAY);
+    DrawAtlasTextUtf8(atlas, GLYPH_SIZE_20, game->topic, x, 52, DARKGRAY);
+
+    if (playerStats) {
+        x = DrawAtlasText(atlas, GLYPH_SIZE_20, "Wins: ", 30, 76, GRAY);
+        x = DrawAtlasNumber(atlas, GLYPH_SIZE_20, (int)playerStats->wins, x, 76, GRAY);
+        x = DrawAtlasText(atlas, GLYPH_SIZE_20, "  Streak: ", x, 76, GRAY);
+        x = DrawAtlasNumber(atlas, GLYPH_SIZE_20, (int)playerStats->currentStreak, x, 76, GRAY);
+        x = DrawAtlasText(atlas, GLYPH_SIZE_20, "  Best: ", x, 76, GRAY);
+        DrawAtlasNumber(atlas, GLYPH_SIZE_20, (int)playerStats->bestStreak, x, 76, GRAY);
+    }
+
+    Rectangle restartBtn = RESTART_BUTTON_RECT;
+    Rectangle quitBtn = QUIT_BUTTON_RECT;
+    DrawRectangle(700, 20, 280, 160, Fade(RAYWHITE, 0.6f));
+    DrawText("Controls", 760, 10, 22, BLUE);
+    DrawRectangleRec(restartBtn, hover.hoverRestart ? SKYBLUE : Fade(LIGHTGRAY, 0.9f));
+    DrawRectangleLinesEx(restartBtn, 2, GRAY);
+    DrawText("Restart (Click)", 760, 52, 20, BLACK);
+    DrawRectangleRec(quitBtn, hover.hoverQuit ? PINK : Fade(LIGHTGRAY, 0.9f));
+    DrawRectangleLinesEx(quitBtn, 2, GRAY);
+    DrawText("Quit (Click)", 760, 112, 20, BLACK);
+
+    Rectangle hintBtn = HINT_BUTTON_RECT;
+    DrawRectangleRec(hintBtn, hover.hoverHint ? LIME : Fade(LIGHTGRAY, 0.9f));
+    DrawRectangleLinesEx(hintBtn, 2, GRAY);
+    DrawText("Hint (Click)", 760, 227, 20, BLACK);
+
+    x = DrawAtlasText(atlas, GLYPH_SIZE_22, "Lives: ", 740, 180, RED);
+    x = DrawAtlasNumber(atlas, GLYPH_SIZE_22, game->livesRemaining, x, 180, RED);
+    x = DrawAtlasText(atlas, GLYPH_SIZE_22, " / ", x, 180, RED);
+    DrawAtlasNumber(atlas, GLYPH_SIZE_22, MAX_TRIES, x, 180, RED);
+    DrawText("Guess the word:", 430, 120, 20, DARKGRAY);
+}
+
+/**
+ * @brief Starts drawing into a layer whose top-left corner sits at (x, y) on screen
+ *
+ * Layers are cleared to the window background so translucent colors blend
+ * exactly as they would when drawn straight to the screen.
+ */
+static void BeginLayer(RenderTexture2D layer, int x, int y) {
+    BeginTextureMode(layer);
+    ClearBackground(RAYWHITE);
+    BeginMode2D((Camera2D){{0, 0}, {(float)x, (float)y}, 0.0f, 1.0f});
+}
+
+static void EndLayer(void) {
+    EndMode2D();
+    EndTextureMode();
+}
+
+/**
+ * @brief Blits a cached layer to the screen at (x, y)
+ */
+void DrawLayer(RenderTexture2D layer, int x, int y) {
+    // Render textures are stored bottom-up, hence the negative source height
+    Rectangle source = {0, 0, (float)layer.texture.width, -(float)layer.texture.height};
+    DrawTextureRec(layer.texture, source, (Vector2){(float)x, (float)y}, WHITE);
+}
+
+/**
+ * @brief Creates the layer textures and renders the gallows for every miss count
+ */
+void LoadUiLayers(UiLayers *layers) {
+    layers->panel = LoadRenderTexture(WINDOW_WIDTH, PANEL_LAYER_HEIGHT);
+    layers->keyboard = LoadRenderTexture(KEYBOARD_LAYER_WIDTH, KEYBOARD_LAYER_HEIGHT);
+
+    for (int misses = 0; misses <= MAX_TRIES; misses++) {
+        layers->gallows[misses] = LoadRenderTexture(GALLOWS_LAYER_WIDTH, GALLOWS_LAYER_HEIGHT);
+        BeginLayer(layers->gallows[misses], GALLOWS_LAYER_X, GALLOWS_LAYER_Y);
+        DrawHangmanFigure(misses);
+        EndLayer();
+    }
+}
+
+/**
+ * @brief Re-renders the layers whose inputs changed this frame
+ */
+void UpdateUiLayers(UiLayers *layers, unsigned int dirty, const GlyphAtlas *atlas, const GameState *game,
+                    const Keyboard *keyboard, HoverState hover, const StatsEntry *playerStats) {
+    if (dirty & (DIRTY_HEADER | DIRTY_PANEL)) {
+        BeginLayer(layers->panel, 0, 0);
+        DrawControlsPanel(atlas, game, hover, playerStats);
+        EndLayer();
+    }
+
+    if (dirty & DIRTY_KEYBOARD) {
+        BeginLayer(layers->keyboard, KEYBOARD_MARGIN_X, KEYBOARD_START_Y);
+        // The gallows frame and base run under the keys and show through the gaps
+        DrawHangmanFigure(0);
+        DrawKeyboard(atlas, keyboard);
+        EndLayer();
+    }
+}
+
+/**
+ * @brief Releases the layer textures
+ */
+void UnloadUiLayers(UiLayers *layers) {
+    UnloadRenderTexture(layers->panel);
+    UnloadRenderTexture(layers->keyboard);
+    for (int misses = 0; misses <= MAX_TRIES; misses++) UnloadRenderTexture(layers->gallows[misses]);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file hangman_word_index.c
+ * @brief Topic and length indexes over a WordList
+ *
+ * Both orderings are built with a counting sort at load time, so building
+ * is O(n) and any topic/length-range filter resolves to one contiguous
+ * slice that a word can be drawn from in constant time.
+ * Requires hangman_random.c earlier in the same build.
+ */
+
+#include "hangman_core.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define INDEX_STRIDE (MAX_WORD_LENGTH + 1)
+
+/**
+ * @brief Builds the length and topic/length orderings for list
+ * @return false on allocation failure (index is left empty)
+ */
+bool BuildWordIndex(WordIndex *index, const WordList *list) {
+    memset(index, 0, sizeof(*index));
+    size_t tableSize = (size_t)list->topicCount * INDEX_STRIDE;
+
+    index->byLength = malloc((size_t)list->wordCount * sizeof(uint32_t));
+    index->byTopicLength = malloc((size_t)list->wordCount * sizeof(uint32_t));
+    index->topicLengthStart = calloc(tableSize ? tableSize : 1, sizeof(uint32_t));
+    if (!index->byLength || !index->byTopicLength || !index->topicLengthStart) {
+        free(index->byLength);
+        free(index->byTopicLength);
+        free(index->topicLengthStart);
+        memset(index, 0, sizeof(*index));
+        return false;
+    }
+    index->topicCount = list->topicCount;
+
+    /* Count per bucket, then turn counts into start positions. */
+    uint32_t *topicStart = index->topicLengthStart;
+    for (uint32_t i = 0; i < list->wordCount; i++) {
+        const WordEntry *entry = &list->entries[i];
+        index->lengthStart[entry->wordLength]++;
+        topicStart[(size_t)entry->topicIndex * INDEX_STRIDE + entry->wordLength]++;
+    }
+
+    uint32_t position = 0;
+    for (int length = 0; length <= MAX_WORD_LENGTH; length++) {
+        uint32_t count = index->lengthStart[length];
+        index->lengthStart[length] = position;
+        position += count;
+    }
+    position = 0;
+    for (size_t slot = 0; slot < tableSize; slot++) {
+        uint32_t count = topicStart[slot];
+        topicStart[slot] = position;
+        position += count;
+    }
+
+    /* Scatter using a moving cursor per bucket, then restore the starts. */
+    for (uint32_t i = 0; i < list->wordCount; i++) {
+        const WordEntry *entry = &list->entries[i];
+        index->byLength[index->lengthStart[entry->wordLength]++] = i;
+        index->byTopicLength[topicStart[(size_t)entry->topicIndex * INDEX_STRIDE + entry->wordLength]++] = i;
+    }
+    for (int length = MAX_WORD_LENGTH; length > 0; length--) {
+        index->lengthStart[length] = index->lengthStart[length - 1];
+    }
+    index->lengthStart[0] = 0;
+    for (size_t slot = tableSize; slot > 1; slot--) {
+        topicStart[slot - 1] = topicStart[slot - 2];
+    }
+    if (tableSize) topicStart[0] = 0;
+
+    return true;
+}
+
+/**
+ * @brief Releases the index arrays
+ */
+void FreeWordIndex(WordIndex *index) {
+    free(index->byLength);
+    free(index->byTopicLength);
+    free(index->topicLengthStart);
+    memset(index, 0, sizeof(*index));
+}
+
+/**
+ * @brief Looks up a topic by name
+ * @return topic index, or -1 if the list has no such topic
+ */
+int FindTopic(const WordList *list, const char *name) {
+    for (uint32_t i = 0; i < list->topicCount; i++) {
+        if (strcmp(list->pool + list->topics[i].nameOffset, name) == 0) return (int)i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Resolves a filter to the contiguous slice of word ids that match it
+ * @return number of matching words; *slice points at the first of them
+ */
+uint32_t FilterWords(const WordIndex *index, const WordFilter *filter, const uint32_t **slice) {
+    int minLength = filter->minLength < 1 ? 1 : filter->minLength;
+    int maxLength = (filter->maxLength <= 0 || filter->maxLength >= MAX_WORD_LENGTH) ? MAX_WORD_LENGTH - 1 : filter->maxLength;
+    *slice = NULL;
+    if (minLength > maxLength) return 0;
+
+    if (filter->topicIndex < 0) {
+        uint32_t first = index->lengthStart[minLength];
+        *slice = index->byLength + first;
+        return index->lengthStart[maxLength + 1] - first;
+    }
+    if ((uint32_t)filter->topicIndex >= index->topicCount) return 0;
+
+    /* The last length bucket of a topic ends where the next topic begins. */
+    const uint32_t *starts = index->topicLengthStart + (size_t)filter->topicIndex * INDEX_STRIDE;
+    uint32_t first = starts[minLength];
+    uint32_t end = starts[maxLength + 1];
+    *slice = index->byTopicLength + first;
+    return end - first;
+}
+
+/**
+ * @brief Draws a word id matching filter, every match equally likely
+ * @return false if no word matches (nothing is drawn from rng)
+ */
+bool SelectWord(const WordIndex *index, const WordFilter *filter, Rng *rng, uint32_t *wordIndex) {
+    const uint32_t *slice;
+    uint32_t count = FilterWords(index, filter, &slice);
+    if (count == 0) return false;
+
+    *wordIndex = slice[RandomBelow(rng, count)];
+    return true;
+}
@@ -0,0 +1,723 @@
+/**
+ * @file hangman_word_list.c
+ * @brief Arena-backed "topic:word" dictionary loader
+ *
+ * The file is UTF-8. An optional first line "#alphabet NAME" picks the
+ * alphabet (see hangman_alphabet.c); without it words are English. The
+ * file is memory-mapped and split at line boundaries into one chunk per
+ * core. Loading runs in three parallel passes with a short serial merge
+ * in between:
+ *   1. parse: each chunk decodes its words into alphabet symbols, folding
+ *      case through the alphabet's lookup tables, and interns topics into
+ *      a chunk-local table;
+ *   2. dedupe: every (topic, word) pair is inserted into one lock-free
+ *      hash set that keeps the earliest occurrence, so the result matches
+ *      a serial load;
+ *   3. copy: surviving words are written into a single arena.
+ * Words are stored as one symbol byte per position, so nothing downstream
+ * decodes or normalizes them again. Each entry costs its symbols plus a
+ * 16-byte WordEntry and there is no cap on the number of words.
+ * Requires hangman_alphabet.c in the same build.
+ */
+
+#include "hangman_core.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <stdatomic.h>
+
+#ifdef _WIN32
+#define WORD_LIST_USE_STDIO 1
+#else
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define WORD_LIST_ALIGN(n)     (((n) + 7u) & ~(size_t)7u)
+#define WORD_LIST_CHUNK_MIN    ((size_t)1 << 20)
+#define WORD_LIST_CHUNK_MAX    ((size_t)1 << 30)
+#define WORD_LIST_MAX_CHUNKS   256
+#define WORD_LIST_DROPPED      UINT32_MAX
+#define WORD_LIST_DIRECTIVE    "#alphabet "
+
+typedef struct {
+    uint32_t *slots;
+    uint32_t capacity;
+} TopicTable;
+
+static uint32_t HashName(const char *text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)text[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Fills the precomputed letter set and distinct-letter count of a word
+ */
+static void ComputeWordMetadata(WordEntry *entry, const Alphabet *alphabet, const uint8_t *symbols, size_t length) {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < length; i++) {
+        int letter = alphabet->symbolLetter[symbols[i]];
+        if (letter != ALPHABET_MARK) mask |= 1ull << letter;
+    }
+    entry->letterMask = mask;
+    entry->distinctLetters = (uint8_t)__builtin_popcountll(mask);
+}
+
+/**
+ * @brief Doubles the topic hash table, keeping existing topic indexes
+ */
+static bool GrowTopicTable(TopicTable *table, const char *pool, const TopicEntry *topics) {
+    uint32_t capacity = table->capacity ? table->capacity * 2 : 64;
+    uint32_t *slots = calloc(capacity, sizeof(uint32_t));
+    if (!slots) return false;
+
+    for (uint32_t i = 0; i < table->capacity; i++) {
+        uint32_t value = table->slots[i];
+        if (!value) continue;
+        const char *name = pool + topics[value - 1].nameOffset;
+        uint32_t pos = HashName(name, strlen(name)) & (capacity - 1);
+        while (slots[pos]) pos = (pos + 1) & (capacity - 1);
+        slots[pos] = value;
+    }
+    free(table->slots);
+    table->slots = slots;
+    table->capacity = capacity;
+    return true;
+}
+
+/* InternTopic failures: the first only rejects the entry, the second the whole load */
+#define WORD_LIST_TOPIC_LIMIT     (-1)
+#define WORD_LIST_TOPIC_NO_MEMORY (-2)
+
+/**
+ * @brief Returns the index of a topic, appending its name to the pool the first time
+ * @return topic index, WORD_LIST_TOPIC_LIMIT for a new topic past MAX_TOPICS,
+ * or WORD_LIST_TOPIC_NO_MEMORY
+ */
+static int InternTopic(WordList *list, TopicTable *table, char *pool, uint32_t *poolUsed,
+                       uint32_t *topicCapacity, const char *name, size_t length) {
+    if ((list->topicCount + 1) * 2 > table->capacity &&
+        !GrowTopicTable(table, pool, list->ownedTopics)) return WORD_LIST_TOPIC_NO_MEMORY;
+
+    uint32_t pos = HashName(name, length) & (table->capacity - 1);
+    while (table->slots[pos]) {
+        uint32_t index = table->slots[pos] - 1;
+        const char *existing = pool + list->ownedTopics[index].nameOffset;
+        if (strncmp(existing, name, length) == 0 && existing[length] == '\0') return (int)index;
+        pos = (pos + 1) & (table->capacity - 1);
+    }
+
+    if (list->topicCount >= MAX_TOPICS) return WORD_LIST_TOPIC_LIMIT;
+    if (list->topicCount == *topicCapacity) {
+        uint32_t capacity = *topicCapacity ? *topicCapacity * 2 : 16;
+        TopicEntry *topics = realloc(list->ownedTopics, capacity * sizeof(TopicEntry));
+        if (!topics) return WORD_LIST_TOPIC_NO_MEMORY;
+        list->ownedTopics = topics;
+        *topicCapacity = capacity;
+    }
+
+    uint32_t index = list->topicCount++;
+    list->ownedTopics[index].nameOffset = *poolUsed;
+    list->ownedTopics[index].wordCount = 0;
+    memcpy(pool + *poolUsed, name, length);
+    pool[*poolUsed + length] = '\0';
+    *poolUsed += (uint32_t)length + 1;
+
+    table->slots[pos] = index + 1;
+    return (int)index;
+}
+
+/* A line that passed validation, before dedupe; offsets are into its chunk's pool. */
+typedef struct {
+    uint32_t wordOffset;
+    uint32_t hash;
+    uint32_t slot;
+    uint16_t topicIndex;
+    uint8_t wordLength;
+} ParsedWord;
+
+typedef struct WordLoader WordLoader;
+
+typedef struct {
+    WordLoader *loader;
+    const char *text;
+    size_t length;
+    WordList topics;        /* chunk-local topic table (ownedTopics, topicCount) */
+    char *pool;
+    uint32_t poolUsed;
+    ParsedWord *words;
+    uint32_t wordCount;
+    uint32_t firstId;       /* global id of words[0]; ids follow file order */
+    uint32_t *topicBytes;   /* pool bytes of surviving words, per local topic */
+    uint32_t *topicFirst;   /* first surviving word, per local topic */
+    uint32_t *topicRemap;   /* local topic -> final topic index */
+    uint32_t keptCount;
+    uint32_t keptBytes;
+    uint32_t entryBase;
+    uint32_t poolBase;
+    bool failed;
+} WordChunk;
+
+struct WordLoader {
+    const Alphabet *alphabet;
+    WordChunk *chunks;
+    int chunkCount;
+    _Atomic uint64_t *slots; /* word hash << 32 | (earliest global id + 1), 0 = empty */
+    uint32_t slotMask;
+    WordEntry *entries;
+    char *pool;
+};
+
+/**
+ * @brief Decodes a UTF-8 word into alphabet symbols and hashes them
+ *
+ * ASCII bytes take one table lookup; other characters are decoded and
+ * found in the alphabet's sorted fold table. Uppercase forms fold to
+ * their lowercase symbol.
+ * @return number of symbols, 0 if the word holds a character outside the
+ * alphabet, has no letter to guess or does not fit in MAX_WORD_LENGTH - 1
+ * positions
+ */
+static size_t NormalizeWord(const Alphabet *alphabet, uint8_t *out, const char *word, size_t length, uint32_t *hash) {
+    size_t count = 0;
+    bool hasLetter = false;
+    for (size_t i = 0; i < length;) {
+        unsigned char c = (unsigned char)word[i];
+        int symbol;
+        if (c < 0x80) {
+            symbol = alphabet->asciiSymbol[c];
+            i++;
+        } else {
+            uint32_t codepoint;
+            int size = DecodeCodepoint(word + i, length - i, &codepoint);
+            if (size == 0) return 0;
+            symbol = AlphabetSymbol(alphabet, codepoint);
+            i += (size_t)size;
+        }
+        if (symbol < 0 || count == MAX_WORD_LENGTH - 1) return 0;
+        hasLetter |= alphabet->symbolLetter[symbol] != ALPHABET_MARK;
+        out[count++] = (uint8_t)symbol;
+    }
+    if (!hasLetter) return 0;
+
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ count;
+    for (size_t i = 0; i < count; i += 8) {
+        uint64_t block = 0;
+        memcpy(&block, out + i, (count - i < 8) ? count - i : 8);
+        h = (h ^ block) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 29;
+    }
+    *hash = (uint32_t)(h >> 32);
+    return count;
+}
+
+/**
+ * @brief Pass 1: parses, validates and normalizes the lines of one chunk
+ *
+ * Blank lines, lines without ':' (including the alphabet directive),
+ * words with characters outside the alphabet, entries whose topic or
+ * word does not fit in MAX_WORD_LENGTH and entries that would add a topic
+ * past MAX_TOPICS are skipped; running out of memory fails the chunk.
+ */
+static void *ParseChunk(void *argument) {
+    WordChunk *chunk = argument;
+    const char *end = chunk->text + chunk->length;
+
+    size_t lineCount = 1;
+    for (const char *p = chunk->text; (p = memchr(p, '\n', (size_t)(end - p))) != NULL; p++) lineCount++;
+
+    /* Per accepted line the pool holds at most the line itself: ':' and '\n' become terminators. */
+    chunk->pool = malloc(chunk->length + 1);
+    chunk->words = malloc(lineCount * sizeof(ParsedWord));
+    if (!chunk->pool || !chunk->words) {
+        chunk->failed = true;
+        return NULL;
+    }
+
+    TopicTable table = {NULL, 0};
+    uint32_t topicCapacity = 0;
+    uint8_t normalized[MAX_WORD_LENGTH];
+
+    const char *line = chunk->text;
+    while (line < end) {
+        const char *newline = memchr(line, '\n', (size_t)(end - line));
+        const char *lineEnd = newline ? newline : end;
+        const char *next = newline ? newline + 1 : end;
+        if (lineEnd > line && lineEnd[-1] == '\r') lineEnd--;
+
+        const char *sep = memchr(line, ':', (size_t)(lineEnd - line));
+        size_t topicLength = sep ? (size_t)(sep - line) : 0;
+        size_t wordLength = 0;
+        uint32_t hash;
+        if (sep && topicLength < MAX_WORD_LENGTH &&
+            (wordLength = NormalizeWord(chunk->loader->alphabet, normalized, sep + 1,
+                                        (size_t)(lineEnd - sep - 1), &hash)) > 0) {
+            int topicIndex = InternTopic(&chunk->topics, &table, chunk->pool, &chunk->poolUsed, &topicCapacity,
+                                         line, topicLength);
+            if (topicIndex == WORD_LIST_TOPIC_NO_MEMORY) {
+                chunk->failed = true;
+                break;
+            }
+            if (topicIndex >= 0) {
+                ParsedWord *word = &chunk->words[chunk->wordCount++];
+                word->wordOffset = chunk->poolUsed;
+                word->hash = hash ^ HashName(line, topicLength);
+                word->topicIndex = (uint16_t)topicIndex;
+                word->wordLength = (uint8_t)wordLength;
+                memcpy(chunk->pool + chunk->poolUsed, normalized, wordLength);
+                chunk->poolUsed += (uint32_t)wordLength;
+            }
+        }
+        line = next;
+    }
+    free(table.slots);
+    return chunk;
+}
+
+/**
+ * @brief Finds the parsed word with a global id, with its symbols and topic name (chunks are few, so a binary search)
+ */
+static const ParsedWord *ParsedWordById(const WordLoader *loader, uint32_t id, const char **text, const char **topic) {
+    int low = 0, high = loader->chunkCount - 1;
+    while (low < high) {
+        int mid = (low + high + 1) / 2;
+        if (loader->chunks[mid].firstId <= id) low = mid;
+        else high = mid - 1;
+    }
+    const WordChunk *chunk = &loader->chunks[low];
+    const ParsedWord *word = &chunk->words[id - chunk->firstId];
+    *text = chunk->pool + word->wordOffset;
+    *topic = chunk->pool + chunk->topics.ownedTopics[word->topicIndex].nameOffset;
+    return word;
+}
+
+/**
+ * @brief Inserts one word into the shared set, keeping the smallest id per distinct (topic, word)
+ *
+ * A slot's word never changes once claimed, only its id shrinks, so the
+ * slot position recorded here stays valid for the survivor check. Topics
+ * are compared by name, as chunk-local topic indexes differ.
+ */
+static void InsertWord(WordLoader *loader, WordChunk *chunk, uint32_t index) {
+    ParsedWord *word = &chunk->words[index];
+    const char *text = chunk->pool + word->wordOffset;
+    const char *topic = chunk->pool + chunk->topics.ownedTopics[word->topicIndex].nameOffset;
+    uint32_t id = chunk->firstId + index + 1;
+    uint64_t mine = ((uint64_t)word->hash << 32) | id;
+
+    for (uint32_t pos = word->hash & loader->slotMask;; pos = (pos + 1) & loader->slotMask) {
+        uint64_t current = atomic_load_explicit(&loader->slots[pos], memory_order_relaxed);
+        while (current == 0) {
+            if (atomic_compare_exchange_weak_explicit(&loader->slots[pos], &current, mine,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                word->slot = pos;
+                return;
+            }
+        }
+        if ((uint32_t)(current >> 32) != word->hash) continue;
+
+        const char *otherText, *otherTopic;
+        const ParsedWord *other = ParsedWordById(loader, (uint32_t)current - 1, &otherText, &otherTopic);
+        if (other->wordLength != word->wordLength || memcmp(otherText, text, word->wordLength) != 0 ||
+            strcmp(otherTopic, topic) != 0) continue;
+
+        while ((uint32_t)current > id &&
+               !atomic_compare_exchange_weak_explicit(&loader->slots[pos], &current, mine,
+                                                      memory_order_relaxed, memory_order_relaxed)) {}
+        word->slot = pos;
+        return;
+    }
+}
+
+/**
+ * @brief Pass 2: adds every word of one chunk to the shared dedupe set
+ */
+static void *DedupeChunk(void *argument) {
+    WordChunk *chunk = argument;
+    for (uint32_t i = 0; i < chunk->wordCount; i++) InsertWord(chunk->loader, chunk, i);
+    return chunk;
+}
+
+/**
+ * @brief Marks duplicates as dropped and sizes the survivors of each local topic
+ */
+static void *CountChunk(void *argument) {
+    WordChunk *chunk = argument;
+    uint32_t topicCount = chunk->topics.topicCount;
+    chunk->topicBytes = calloc(topicCount ? topicCount : 1, sizeof(uint32_t));
+    chunk->topicFirst = malloc((topicCount ? topicCount : 1) * sizeof(uint32_t));
+    chunk->topicRemap = malloc((topicCount ? topicCount : 1) * sizeof(uint32_t));
+    if (!chunk->topicBytes || !chunk->topicFirst || !chunk->topicRemap) {
+        chunk->failed = true;
+        return NULL;
+    }
+
+    for (uint32_t t = 0; t < topicCount; t++) {
+        chunk->topics.ownedTopics[t].wordCount = 0;
+        chunk->topicFirst[t] = WORD_LIST_DROPPED;
+    }
+    for (uint32_t i = 0; i < chunk->wordCount; i++) {
+        ParsedWord *word = &chunk->words[i];
+        uint64_t slot = atomic_load_explicit(&chunk->loader->slots[word->slot], memory_order_relaxed);
+        if ((uint32_t)slot != chunk->firstId + i + 1) {
+            word->slot = WORD_LIST_DROPPED;
+            continue;
+        }
+        if (chunk->topicFirst[word->topicIndex] == WORD_LIST_DROPPED) chunk->topicFirst[word->topicIndex] = i;
+        chunk->topics.ownedTopics[word->topicIndex].wordCount++;
+        chunk->topicBytes[word->topicIndex] += word->wordLength;
+    }
+    return chunk;
+}
+
+/**
+ * @brief Pass 3: copies the surviving words of one chunk to their final place
+ */
+static void *CopyChunk(void *argument) {
+    WordChunk *chunk = argument;
+    WordLoader *loader = chunk->loader;
+    uint32_t entryIndex = chunk->entryBase;
+    uint32_t poolUsed = chunk->poolBase;
+
+    for (uint32_t i = 0; i < chunk->wordCount; i++) {
+        const ParsedWord *word = &chunk->words[i];
+        if (word->slot == WORD_LIST_DROPPED || chunk->topicRemap[word->topicIndex] == WORD_LIST_DROPPED) continue;
+
+        const uint8_t *symbols = (const uint8_t *)chunk->pool + word->wordOffset;
+        WordEntry *entry = &loader->entries[entryIndex++];
+        entry->wordOffset = poolUsed;
+        entry->topicIndex = (uint16_t)chunk->topicRemap[word->topicIndex];
+        entry->wordLength = word->wordLength;
+        ComputeWordMetadata(entry, loader->alphabet, symbols, word->wordLength);
+        memcpy(loader->pool + poolUsed, symbols, word->wordLength);
+        poolUsed += word->wordLength;
+    }
+    return chunk;
+}
+
+/**
+ * @brief Runs one pass over every chunk, one thread per chunk
+ *
+ * Chunks whose thread cannot be started are processed on the calling
+ * thread, so a pass always completes.
+ * @return false if any chunk ran out of memory
+ */
+static bool RunChunkPass(WordLoader *loader, void *(*pass)(void *)) {
+#ifndef WORD_LIST_USE_STDIO
+    pthread_t threads[WORD_LIST_MAX_CHUNKS];
+    bool started[WORD_LIST_MAX_CHUNKS] = {false};
+    for (int i = 1; i < loader->chunkCount; i++) {
+        started[i] = pthread_create(&threads[i], NULL, pass, &loader->chunks[i]) == 0;
+    }
+    pass(&loader->chunks[0]);
+    for (int i = 1; i < loader->chunkCount; i++) {
+        if (started[i]) pthread_join(threads[i], NULL);
+        else pass(&loader->chunks[i]);
+    }
+#else
+    for (int i = 0; i < loader->chunkCount; i++) pass(&loader->chunks[i]);
+#endif
+
+    for (int i = 0; i < loader->chunkCount; i++) {
+        if (loader->chunks[i].failed) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief One chunk per core, but no chunk under 1 MiB or over 1 GiB
+ */
+static int ChooseChunkCount(size_t length) {
+    size_t count = length / WORD_LIST_CHUNK_MIN;
+#ifndef WORD_LIST_USE_STDIO
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus > 0 && count > (size_t)cpus) count = (size_t)cpus;
+#else
+    count = 1;
+#endif
+    size_t needed = (length + WORD_LIST_CHUNK_MAX - 1) / WORD_LIST_CHUNK_MAX;
+    if (count < needed) count = needed;
+    if (count < 1) count = 1;
+    return (count > WORD_LIST_MAX_CHUNKS) ? 0 : (int)count;
+}
+
+static int CompareTopicOrder(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Interns the topics that kept words, in order of their first kept word
+ *
+ * Ordering by first surviving word (not first appearance in a chunk)
+ * makes topic indexes independent of how the file was chunked.
+ * @return false on allocation failure
+ */
+static bool MergeTopics(WordList *list, WordLoader *loader, char *pool, uint32_t *poolUsed) {
+    TopicTable table = {NULL, 0};
+    uint32_t topicCapacity = 0;
+    bool ok = true;
+
+    for (int c = 0; c < loader->chunkCount && ok; c++) {
+        WordChunk *chunk = &loader->chunks[c];
+        uint32_t topicCount = chunk->topics.topicCount;
+        uint64_t *order = malloc((topicCount ? topicCount : 1) * sizeof(uint64_t));
+        if (!order) {
+            ok = false;
+            break;
+        }
+
+        uint32_t kept = 0;
+        for (uint32_t t = 0; t < topicCount; t++) {
+            chunk->topicRemap[t] = WORD_LIST_DROPPED;
+            if (chunk->topics.ownedTopics[t].wordCount) order[kept++] = ((uint64_t)chunk->topicFirst[t] << 32) | t;
+        }
+        qsort(order, kept, sizeof(uint64_t), CompareTopicOrder);
+
+        for (uint32_t k = 0; k < kept; k++) {
+            uint32_t t = (uint32_t)order[k];
+            const char *name = chunk->pool + chunk->topics.ownedTopics[t].nameOffset;
+            int topicIndex = InternTopic(list, &table, pool, poolUsed, &topicCapacity, name, strlen(name));
+            if (topicIndex == WORD_LIST_TOPIC_NO_MEMORY) {
+                ok = false;
+                break;
+            }
+            if (topicIndex < 0) continue;
+
+            chunk->topicRemap[t] = (uint32_t)topicIndex;
+            list->ownedTopics[topicIndex].wordCount += chunk->topics.ownedTopics[t].wordCount;
+            chunk->keptCount += chunk->topics.ownedTopics[t].wordCount;
+            chunk->keptBytes += chunk->topicBytes[t];
+        }
+        free(order);
+    }
+    free(table.slots);
+    return ok;
+}
+
+static void FreeWordLoader(WordLoader *loader) {
+    for (int c = 0; c < loader->chunkCount; c++) {
+        WordChunk *chunk = &loader->chunks[c];
+        free(chunk->pool);
+        free(chunk->words);
+        free(chunk->topicBytes);
+        free(chunk->topicFirst);
+        free(chunk->topicRemap);
+        free(chunk->topics.ownedTopics);
+    }
+    free(loader->chunks);
+    free((void *)loader->slots);
+}
+
+/**
+ * @brief 32-bit FNV-1a of the alphabet, word pool and count; game logs and snapshots only replay against the same list
+ */
+uint32_t WordListId(const WordList *list) {
+    uint32_t hash = 2166136261u ^ list->wordCount;
+    for (const char *c = list->alphabet.name; *c; c++) {
+        hash ^= (unsigned char)*c;
+        hash *= 16777619u;
+    }
+    for (uint32_t i = 0; i < list->poolSize; i++) {
+        hash ^= (unsigned char)list->pool[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Parses "topic:word" lines from a buffer into list, on all cores for large inputs
+ *
+ * Words are decoded into the alphabet named by a leading "#alphabet NAME"
+ * line (English by default), words with characters outside it are
+ * skipped, and a word repeated under the same topic keeps only its first
+ * occurrence; the same word under another topic is a separate entry.
+ * @return number of words loaded; 0 means nothing usable or an unknown
+ * alphabet (list stays empty)
+ */
+int LoadWordListFromMemory(WordList *list, const char *text, size_t length) {
+    memset(list, 0, sizeof(*list));
+    int chunkCount = ChooseChunkCount(length);
+    if (length == 0 || chunkCount == 0) return 0;
+
+    char alphabetName[ALPHABET_NAME_LENGTH] = "english";
+    size_t directiveLength = sizeof(WORD_LIST_DIRECTIVE) - 1;
+    if (length > directiveLength && memcmp(text, WORD_LIST_DIRECTIVE, directiveLength) == 0) {
+        const char *name = text + directiveLength;
+        const char *newline = memchr(name, '\n', length - directiveLength);
+        size_t nameLength = (size_t)((newline ? newline : text + length) - name);
+        if (nameLength > 0 && name[nameLength - 1] == '\r') nameLength--;
+        if (nameLength >= sizeof(alphabetName)) return 0;
+        memcpy(alphabetName, name, nameLength);
+        alphabetName[nameLength] = '\0';
+    }
+    if (!BuildAlphabet(&list->alphabet, alphabetName)) return 0;
+
+    WordLoader loader = {&list->alphabet, NULL, 0, NULL, 0, NULL, NULL};
+    loader.chunks = calloc((size_t)chunkCount, sizeof(WordChunk));
+    if (!loader.chunks) return 0;
+    loader.chunkCount = chunkCount;
+
+    const char *end = text + length;
+    const char *chunkStart = text;
+    for (int c = 0; c < chunkCount; c++) {
+        const char *chunkEnd = end;
+        if (c + 1 < chunkCount) {
+            const char *target = text + length / (size_t)chunkCount * (size_t)(c + 1);
+            if (target < chunkStart) target = chunkStart;
+            const char *newline = memchr(target, '\n', (size_t)(end - target));
+            chunkEnd = newline ? newline + 1 : end;
+        }
+        loader.chunks[c].loader = &loader;
+        loader.chunks[c].text = chunkStart;
+        loader.chunks[c].length = (size_t)(chunkEnd - chunkStart);
+        chunkStart = chunkEnd;
+    }
+
+    bool ok = RunChunkPass(&loader, ParseChunk);
+
+    uint64_t parsedCount = 0;
+    for (int c = 0; ok && c < chunkCount; c++) {
+        loader.chunks[c].firstId = (uint32_t)parsedCount;
+        parsedCount += loader.chunks[c].wordCount;
+    }
+    ok = ok && parsedCount > 0 && parsedCount < UINT32_MAX / 2;
+
+    if (ok) {
+        uint32_t slotCount = 64;
+        while (slotCount < parsedCount * 2) slotCount *= 2;
+        loader.slots = calloc(slotCount, sizeof(uint64_t));
+        loader.slotMask = slotCount - 1;
+        ok = loader.slots && RunChunkPass(&loader, DedupeChunk) && RunChunkPass(&loader, CountChunk);
+    }
+    free((void *)loader.slots);
+    loader.slots = NULL;
+
+    /* Upper bound of the final pool: every kept topic name plus every kept word. */
+    uint64_t keptCount = 0, poolBound = 0;
+    for (int c = 0; ok && c < chunkCount; c++) {
+        const WordChunk *chunk = &loader.chunks[c];
+        for (uint32_t t = 0; t < chunk->topics.topicCount; t++) {
+            if (!chunk->topics.ownedTopics[t].wordCount) continue;
+            keptCount += chunk->topics.ownedTopics[t].wordCount;
+            poolBound += strlen(chunk->pool + chunk->topics.ownedTopics[t].nameOffset) + 1 + chunk->topicBytes[t];
+        }
+    }
+    ok = ok && poolBound < UINT32_MAX;
+
+    char *arena = NULL;
+    if (ok) {
+        size_t entriesSize = WORD_LIST_ALIGN(keptCount * sizeof(WordEntry));
+        arena = malloc(entriesSize + poolBound);
+        loader.entries = (WordEntry *)arena;
+        loader.pool = arena + entriesSize;
+    }
+
+    uint32_t poolUsed = 0;
+    ok = arena && MergeTopics(list, &loader, loader.pool, &poolUsed);
+    for (int c = 0; ok && c < chunkCount; c++) {
+        loader.chunks[c].entryBase = list->wordCount;
+        loader.chunks[c].poolBase = poolUsed;
+        list->wordCount += loader.chunks[c].keptCount;
+        poolUsed += loader.chunks[c].keptBytes;
+    }
+    ok = ok && list->wordCount > 0 && RunChunkPass(&loader, CopyChunk);
+    FreeWordLoader(&loader);
+
+    if (!ok) {
+        free(arena);
+        free(list->ownedTopics);
+        memset(list, 0, sizeof(*list));
+        return 0;
+    }
+
+    list->arena = arena;
+    list->pool = loader.pool;
+    list->poolSize = poolUsed;
+    list->entries = loader.entries;
+    list->topics = list->ownedTopics;
+    list->dictionaryId = WordListId(list);
+    return (int)list->wordCount;
+}
+
+/**
+ * @brief Loads word entries from file in "topic:word" format
+ * @return number of words loaded, 0 if the file is missing or empty
+ */
+int LoadWordList(const char *filename, WordList *list) {
+    memset(list, 0, sizeof(*list));
+    int count = 0;
+
+#ifdef WORD_LIST_USE_STDIO
+    FILE *file = fopen(filename, "rb");
+    if (!file) return 0;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *buffer = (size > 0) ? malloc((size_t)size) : NULL;
+    if (buffer && fread(buffer, 1, (size_t)size, file) == (size_t)size) {
+        count = LoadWordListFromMemory(list, buffer, (size_t)size);
+    }
+    free(buffer);
+    fclose(file);
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return 0;
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        size_t size = (size_t)info.st_size;
+        void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            posix_madvise(mapping, size, POSIX_MADV_SEQUENTIAL);
+            count = LoadWordListFromMemory(list, mapping, size);
+            munmap(mapping, size);
+        }
+    }
+    close(fd);
+#endif
+
+    return count;
+}
+
+/**
+ * @brief Releases the arena, topic table or dictionary mapping of a loaded list
+ */
+void FreeWordList(WordList *list) {
+    free(list->arena);
+    free(list->ownedTopics);
+#ifndef WORD_LIST_USE_STDIO
+    if (list->mapping) munmap(list->mapping, list->mappingSize);
+#endif
+    memset(list, 0, sizeof(*list));
+}
+
+/**
+ * @brief Symbols of word index; entries[index].wordLength of them, not terminated
+ */
+const uint8_t *WordListSymbols(const WordList *list, uint32_t index) {
+    return (const uint8_t *)list->pool + list->entries[index].wordOffset;
+}
+
+/**
+ * @brief Writes word index as NUL-terminated UTF-8 (for output, not for play)
+ * @return bytes written, excluding the terminator
+ */
+size_t WordListWordText(const WordList *list, uint32_t index, char *out, size_t size) {
+    return EncodeSymbols(&list->alphabet, WordListSymbols(list, index), list->entries[index].wordLength, out, size);
+}
+
+/**
+ * @brief NUL-terminated topic name of word index
+ */
+const char *WordListTopic(const WordList *list, uint32_t index) {
+    return list->pool + list->topics[list->entries[index].topicIndex].nameOffset;
+}
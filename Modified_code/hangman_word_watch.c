@@ -0,0 +1,261 @@
+/**
+ * @file hangman_word_watch.c
+ * @brief Word bundles and live reload of the word file
+ *
+ * A WordWatcher thread waits on inotify for the word file to be rewritten
+ * or replaced, loads it and builds the index, solver and dictionary id,
+ * then parks the finished bundle as pending. The game watches words.txt,
+ * the file people edit, even when it started from words.hgd; each reload
+ * recompiles an existing words.hgd so the next start sees the edit too. The game thread picks it up
+ * between rounds with SwapReloadedWords, which only exchanges pointers;
+ * the old bundle is handed back and freed on the watcher thread, so
+ * neither loading nor freeing ever runs inside a frame. Rounds in progress
+ * are unaffected because GameState keeps its own copy of the word.
+ * Watching is Linux-only; elsewhere StartWordWatcher returns false and the
+ * first list stays in use. Requires hangman_word_list.c,
+ * hangman_dictionary.c, hangman_word_index.c, hangman_solver.c,
+ * hangman_difficulty.c and hangman_game_record.c in the same build.
+ */
+
+#include "hangman_core.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#define WORD_WATCH_SETTLE_MS 100
+
+/**
+ * @brief Wraps a loaded list into a new bundle, taking ownership of *words
+ *
+ * Hints are disabled (hintsAvailable false) if the solver cannot be built.
+ * Difficulty ratings blend in DIFFICULTY_SCORES_FILE when it was written
+ * for this list; without them rounds draw words uniformly.
+ * @return the bundle, or NULL if it cannot be allocated (words is freed)
+ */
+WordBundle *CreateWordBundle(WordList *words) {
+    WordBundle *bundle = calloc(1, sizeof(WordBundle));
+    if (!bundle) {
+        FreeWordList(words);
+        return NULL;
+    }
+
+    bundle->words = *words;
+    memset(words, 0, sizeof(*words));
+    bundle->hintsAvailable = BuildWordIndex(&bundle->index, &bundle->words) &&
+                             BuildSolver(&bundle->solver, &bundle->words, &bundle->index) &&
+                             InitializeSolverScratch(&bundle->scratch, &bundle->solver);
+    BuildDifficultyIndex(&bundle->difficulty, &bundle->words, DIFFICULTY_SCORES_FILE);
+    bundle->dictionaryId = GameLogDictionaryId(&bundle->words);
+    return bundle;
+}
+
+/**
+ * @brief Loads a binary dictionary or "topic:word" text file into a new bundle
+ * @return NULL if the file is missing, empty or cannot be loaded
+ */
+WordBundle *LoadWordBundle(const char *filename) {
+    WordList words;
+    if (LoadWordFile(filename, &words, NULL) == 0) return NULL;
+    return CreateWordBundle(&words);
+}
+
+void FreeWordBundle(WordBundle *bundle) {
+    if (!bundle) return;
+    FreeSolverScratch(&bundle->scratch);
+    FreeSolver(&bundle->solver);
+    FreeDifficultyIndex(&bundle->difficulty);
+    FreeWordIndex(&bundle->index);
+    FreeWordList(&bundle->words);
+    free(bundle);
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Drains queued inotify events
+ * @return true if any of them finished writing or moved in the watched file
+ */
+static bool WatchedFileChanged(WordWatcher *watcher) {
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    bool changed = false;
+
+    ssize_t length;
+    while ((length = read(watcher->notifyFd, buffer, sizeof(buffer))) > 0) {
+        for (char *p = buffer; p < buffer + length;) {
+            const struct inotify_event *event = (const struct inotify_event *)p;
+            if (event->len && strcmp(event->name, watcher->filename) == 0 &&
+                (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))) changed = true;
+            p += sizeof(struct inotify_event) + event->len;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief Wakes the watcher thread; a failed write means a wake-up is already queued
+ */
+static void WakeWordWatcher(WordWatcher *watcher) {
+    ssize_t written = write(watcher->wakeFds[1], "", 1);
+    (void)written;
+}
+
+static void *WordWatcherThread(void *argument) {
+    WordWatcher *watcher = argument;
+
+    for (;;) {
+        struct pollfd fds[2] = {{watcher->notifyFd, POLLIN, 0}, {watcher->wakeFds[0], POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0) continue;
+
+        if (fds[1].revents & POLLIN) {
+            char drain[64];
+            while (read(watcher->wakeFds[0], drain, sizeof(drain)) > 0) {}
+        }
+
+        pthread_mutex_lock(&watcher->lock);
+        WordBundle *retired = watcher->retired;
+        watcher->retired = NULL;
+        bool stopping = watcher->stopping;
+        pthread_mutex_unlock(&watcher->lock);
+        FreeWordBundle(retired);
+        if (stopping) break;
+
+        if (!(fds[0].revents & POLLIN) || !WatchedFileChanged(watcher)) continue;
+
+        // Editors and copy tools write in bursts; load once the file has been quiet for a moment
+        struct pollfd settle = {watcher->notifyFd, POLLIN, 0};
+        while (poll(&settle, 1, WORD_WATCH_SETTLE_MS) > 0) WatchedFileChanged(watcher);
+
+        WordBundle *fresh = LoadWordBundle(watcher->path);
+        if (!fresh) continue;
+        if (watcher->compiledPath[0] && IsDictionaryFile(watcher->compiledPath)) {
+            WriteDictionary(&fresh->words, watcher->compiledPath);
+        }
+
+        pthread_mutex_lock(&watcher->lock);
+        WordBundle *stale = watcher->pending;
+        watcher->pending = fresh;
+        pthread_mutex_unlock(&watcher->lock);
+        FreeWordBundle(stale);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Starts watching path for changes
+ *
+ * The containing directory is watched rather than the file, so a file
+ * replaced by rename (as most editors save) is still seen.
+ * @param compiledPath dictionary to recompile from every reload if it exists, or NULL
+ * @return false if watching is unavailable; the game then keeps its first list
+ */
+bool StartWordWatcher(WordWatcher *watcher, const char *path, const char *compiledPath) {
+    memset(watcher, 0, sizeof(*watcher));
+    watcher->notifyFd = watcher->wakeFds[0] = watcher->wakeFds[1] = -1;
+    if (strlen(path) >= sizeof(watcher->path)) return false;
+    if (compiledPath && strlen(compiledPath) >= sizeof(watcher->compiledPath)) return false;
+
+    strcpy(watcher->path, path);
+    if (compiledPath) strcpy(watcher->compiledPath, compiledPath);
+    const char *slash = strrchr(path, '/');
+    if (slash) {
+        size_t length = (size_t)(slash - path);
+        memcpy(watcher->directory, path, length ? length : 1);
+        watcher->filename = watcher->path + (slash - path) + 1;
+    } else {
+        strcpy(watcher->directory, ".");
+        watcher->filename = watcher->path;
+    }
+
+    watcher->notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    bool ok = watcher->notifyFd >= 0 &&
+              inotify_add_watch(watcher->notifyFd, watcher->directory, IN_CLOSE_WRITE | IN_MOVED_TO) >= 0 &&
+              pipe(watcher->wakeFds) == 0;
+    if (ok) {
+        fcntl(watcher->wakeFds[0], F_SETFL, O_NONBLOCK);
+        fcntl(watcher->wakeFds[1], F_SETFL, O_NONBLOCK);
+        pthread_mutex_init(&watcher->lock, NULL);
+        ok = pthread_create(&watcher->thread, NULL, WordWatcherThread, watcher) == 0;
+        if (!ok) pthread_mutex_destroy(&watcher->lock);
+    }
+    if (!ok) {
+        if (watcher->notifyFd >= 0) close(watcher->notifyFd);
+        if (watcher->wakeFds[0] >= 0) close(watcher->wakeFds[0]);
+        if (watcher->wakeFds[1] >= 0) close(watcher->wakeFds[1]);
+        watcher->notifyFd = watcher->wakeFds[0] = watcher->wakeFds[1] = -1;
+        return false;
+    }
+    watcher->running = true;
+    return true;
+}
+
+/**
+ * @brief Installs a reloaded bundle, if one is ready; call only between rounds
+ *
+ * Costs a pointer swap: the replaced bundle is freed on the watcher thread.
+ * @return true if *current now points at a new bundle
+ */
+bool SwapReloadedWords(WordWatcher *watcher, WordBundle **current) {
+    if (!watcher->running) return false;
+
+    // The previous swap's bundle must be freed first; until then the new one stays pending
+    pthread_mutex_lock(&watcher->lock);
+    WordBundle *fresh = watcher->retired ? NULL : watcher->pending;
+    if (fresh) {
+        watcher->pending = NULL;
+        watcher->retired = *current;
+    }
+    pthread_mutex_unlock(&watcher->lock);
+    if (!fresh) return false;
+
+    *current = fresh;
+    WakeWordWatcher(watcher);
+    return true;
+}
+
+/**
+ * @brief Stops the watcher thread and frees any bundle it still holds
+ */
+void StopWordWatcher(WordWatcher *watcher) {
+    if (!watcher->running) return;
+
+    pthread_mutex_lock(&watcher->lock);
+    watcher->stopping = true;
+    pthread_mutex_unlock(&watcher->lock);
+    WakeWordWatcher(watcher);
+    pthread_join(watcher->thread, NULL);
+
+    FreeWordBundle(watcher->pending);
+    FreeWordBundle(watcher->retired);
+    close(watcher->notifyFd);
+    close(watcher->wakeFds[0]);
+    close(watcher->wakeFds[1]);
+    pthread_mutex_destroy(&watcher->lock);
+    watcher->running = false;
+}
+
+#else
+
+bool StartWordWatcher(WordWatcher *watcher, const char *path, const char *compiledPath) {
+    (void)path;
+    (void)compiledPath;
+    memset(watcher, 0, sizeof(*watcher));
+    return false;
+}
+
+bool SwapReloadedWords(WordWatcher *watcher, WordBundle **current) {
+    (void)watcher;
+    (void)current;
+    return false;
+}
+
+void StopWordWatcher(WordWatcher *watcher) {
+    (void)watcher;
+}
+
+#endif